@@ -0,0 +1,84 @@
+/*========================================================================
+  spi-oled
+  atlas.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+========================================================================*/
+#pragma once
+
+#include <stdint.h>
+#include "defs.h"
+
+// A glyph atlas is a font compiled, at build time, for drawing into the
+//  frame buffer. Each glyph is trimmed to the box that contains its 
+//  pixels, and stored as rows in one of the formats below. Atlases are 
+//  generated from the STM32-style font tables, or from BDF files, by 
+//  tools/fontc
+//
+// ATLAS_BITS: one bit per pixel, the first pixel of each row in the top 
+//  bit of its first byte. Each row is expanded to nibble masks, through
+//  a lookup table, as it is drawn. This is the most compact format, and
+//  the one that fontc generates for ordinary fonts
+// ATLAS_MASKS: rows of nibble masks in the frame buffer's own layout --
+//  0xF where the glyph has a pixel, and 0 where it doesn't -- with the 
+//  first pixel of each row in the high nibble of its first byte. Drawing
+//  is a masked write of whole bytes, with no decoding at all, but the 
+//  data is four times the size. Used for glyphs built at run time
+// ATLAS_COVERAGE: laid out as ATLAS_MASKS, but each nibble is a 
+//  coverage level from 0 (none) to 15 (full), and glyphs are blended 
+//  into the buffer. Used for anti-aliased fonts
+#define ATLAS_BITS     0
+#define ATLAS_MASKS    1
+#define ATLAS_COVERAGE 2
+
+typedef struct _AtlasGlyph
+  {
+  uint32_t offset; // Of the glyph's first row, in the atlas data
+  uint8_t x;       // Position of the glyph's box within the character cell
+  uint8_t y;
+  uint8_t w;       // Size of the glyph's box. Zero for a blank glyph
+  uint8_t h;
+  } AtlasGlyph;
+
+// Glyphs are looked up by Unicode code point through a two-level table.
+//  pages has one entry for each block of 256 code points below 'limit',
+//  giving the block's page in index, or ATLAS_NO_GLYPH if the font has 
+//  nothing in that block. Each page of index has 256 entries (the last
+//  stops at 'limit'), giving the glyph number or ATLAS_NO_GLYPH. So a 
+//  lookup is two array reads, however many glyphs the font has, and a 
+//  sparse font costs only the pages it uses
+#define ATLAS_NO_GLYPH 0xFFFF
+
+typedef struct _Atlas
+  {
+  uint32_t limit;  // One past the highest code point in the font
+  const uint16_t *pages;
+  const uint16_t *index;
+  const AtlasGlyph *glyphs;
+  const uint8_t *data;
+  uint8_t format; // ATLAS_BITS, ATLAS_MASKS, or ATLAS_COVERAGE
+  } Atlas;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Get the glyph for Unicode code point c, or NULL if the atlas doesn't 
+//  have it
+const AtlasGlyph *atlas_glyph (const Atlas *atlas, uint32_t c);
+
+// Draw a glyph from an atlas into a 4bpp buffer, for a character cell 
+//  of cell_w x cell_h pixels whose top-left corner is at x,y. Only the 
+//  part of the cell within the clip rectangle cx1,cy1 to cx2,cy2 
+//  (exclusive) is drawn. If opaque is TRUE, the rest of the cell is 
+//  filled with bg. For a coverage atlas, each pixel is blended between
+//  fg and whatever is under it -- or bg, if opaque is TRUE -- in 
+//  proportion to its coverage
+void atlas_blit (const Atlas *atlas, const AtlasGlyph *g, uint8_t *buffer, 
+      int stride, int x, int y, int cell_w, int cell_h, int cx1, int cy1, 
+      int cx2, int cy2, uint8_t fg, uint8_t bg, BOOL opaque);
+
+#ifdef __cplusplus
+}
+#endif
+
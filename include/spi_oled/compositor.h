@@ -0,0 +1,83 @@
+/*========================================================================
+  spi-oled
+  compositor.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+========================================================================*/
+#pragma once
+
+#include "spi_oled.h"
+#include "surface.h"
+
+// The most layers a compositor can have
+#define COMPOSITOR_MAX_LAYERS 8
+
+// A layer's 'key' when none of its colours is transparent
+#define COMPOSITOR_NO_KEY -1
+
+// One layer: a surface placed at x,y on the screen. Pixels of colour
+//  'key' are transparent, and the rest are blended over the layers
+//  below with opacity 'alpha', from 0 (invisible) to 15 (opaque).
+//  Draw on the surface with spi_oled_set_target(); changes are tracked
+//  by the surface's damage rectangle. Change the other fields only
+//  through the compositor_ functions, which record what they uncover
+typedef struct _CompositorLayer
+  {
+  SPIOledSurface *surface;
+  int x;
+  int y;
+  int key;
+  uint8_t alpha;
+  } CompositorLayer;
+
+// A stack of layers, bottom first, over a plain background colour.
+//  x1,y1 to x2,y2 (exclusive) is screen area that has to be composited
+//  again whatever the layers' damage, because a layer was moved, or
+//  had its transparency changed, or nothing has been composited yet
+typedef struct _Compositor
+  {
+  CompositorLayer layers[COMPOSITOR_MAX_LAYERS];
+  int n_layers;
+  uint8_t background;
+  int x1, y1, x2, y2;
+  } Compositor;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Create a compositor with no layers, over a background of the given
+//  colour. The first composite covers the whole screen, so that the 
+//  parts that no layer covers are filled with the background
+Compositor *compositor_new (uint8_t background);
+
+// Free the compositor, and all its layers' surfaces
+void compositor_free (Compositor *self);
+
+// Add a w x h layer, initially all colour 0, on top of the others. It
+//  is owned by the compositor. Returns NULL if there are already
+//  COMPOSITOR_MAX_LAYERS layers
+CompositorLayer *compositor_add_layer (Compositor *self, int x, int y,
+      int w, int h, int key, uint8_t alpha);
+
+// Move a layer to x,y on the screen
+void compositor_move_layer (Compositor *self, CompositorLayer *layer,
+      int x, int y);
+
+// Change a layer's transparent colour and opacity
+void compositor_set_blend (Compositor *self, CompositorLayer *layer,
+      int key, uint8_t alpha);
+
+// Composite the layers into the screen of oled, but only where a layer
+//  has been drawn on, or uncovered, since the last call. Each area is
+//  built up from the topmost layer that covers it opaquely, so the work
+//  done depends on the size of the changes, not on the size of the
+//  screen or the number of layers. The areas are marked for flushing,
+//  and the layers' damage rectangles emptied. The clip rectangle and
+//  drawing target of oled are not used
+void compositor_composite (Compositor *self, SPIOled *oled);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -51,11 +51,16 @@
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
 
+struct _Atlas;
+
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  /* Glyphs compiled by tools/fontc, or NULL. If table is NULL, the 
+     font exists only as an atlas, as the built-in fonts do */
+  const struct _Atlas *atlas;
   
 } sFONT;
 
@@ -64,6 +69,8 @@ extern sFONT Font20;
 extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
+/* Anti-aliased, 9x12, generated from Font24 by tools/fontc */
+extern sFONT Font12AA;
 
 #ifdef __cplusplus
 }
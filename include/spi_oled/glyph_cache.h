@@ -0,0 +1,61 @@
+/*========================================================================
+  spi-oled
+  glyph_cache.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+========================================================================*/
+#pragma once
+
+#include <stdint.h>
+#include "defs.h"
+#include "fonts.h"
+
+// Number of slots in the glyph cache. Each slot holds one glyph at one
+//  horizontal phase; a collision simply replaces the older glyph
+#define GLYPH_CACHE_SLOTS 256
+
+// A glyph expanded from the font's 1bpp rows into a nibble-packed mask, 
+//  in the same layout as the frame buffer. Each nibble is 0xF where the 
+//  glyph has a pixel, and 0 where it doesn't. The glyph is positioned 
+//  'phase' nibbles into the first byte of each row, so that a glyph 
+//  drawn at x can be written a byte at a time, starting at byte x/2, 
+//  when phase is x % 2
+typedef struct _Glyph
+  {
+  const sFONT *font;
+  char c;
+  int phase;
+  int row_bytes;
+  int height;
+  uint8_t *mask;
+  int capacity; // Bytes allocated for mask
+  } Glyph;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Get the expanded glyph for character c in the specified font, at the
+//  specified phase (0 or 1), expanding it if it is not in the cache.
+//  Returns NULL if the character is not in the font. The glyph remains
+//  valid until the next call
+const Glyph *glyph_cache_get (const sFONT *font, char c, int phase);
+
+// Write rows row1 to row2 of a glyph into a 4bpp buffer, with its 
+//  top-left corner at x,y, in the specified colour. The whole width of
+//  the glyph must be within the buffer. There is no clipping
+void glyph_blit (const Glyph *glyph, uint8_t *buffer, int stride, 
+      int x, int y, int row1, int row2, uint8_t colour);
+
+// As glyph_blit(), but writing every pixel of the glyph box -- the 
+//  glyph in colour fg, and the background in colour bg
+void glyph_blit_opaque (const Glyph *glyph, uint8_t *buffer, int stride, 
+      int x, int y, int row1, int row2, uint8_t fg, uint8_t bg);
+
+// Empty the cache, and free the memory it uses
+void glyph_cache_clear (void);
+
+#ifdef __cplusplus
+}
+#endif
+
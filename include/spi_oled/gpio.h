@@ -6,19 +6,73 @@
 ========================================================================*/
 #pragma once
 
+#include <stdint.h>
 #include "defs.h"
 
 typedef enum {GPIO_IN=0, GPIO_OUT} GPIODirection;
 typedef enum {GPIO_LOW=0, GPIO_HIGH} GPIOLevel;
 
+// The sysfs interface is deprecated, and needs a write() per line; the
+//  character device interface (/dev/gpiochipN) can set several lines
+//  in one ioctl(). GPIO_BACKEND_AUTO tries the character device first,
+//  and falls back to sysfs
+typedef enum 
+  {
+  GPIO_BACKEND_SYSFS = 0,
+  GPIO_BACKEND_CHARDEV,
+  GPIO_BACKEND_AUTO
+  } GPIOBackend;
+
+// Default location of the sysfs GPIO interface
+#define GPIO_SYSFS_ROOT "/sys/class/gpio"
+
+// Maximum number of lines that can be held by one GPIO object
+#define GPIO_MAX_LINES 8
+
+// A GPIO object holds a set of output lines open for its whole lifetime, 
+//  so setting a line costs a single write, rather than a path lookup,
+//  open(), write(), and close(). Lines are identified by their index
+//  in the array of pins passed to gpio_open()
+typedef struct _GPIO
+  {
+  GPIOBackend backend;
+  int n;
+  int pins[GPIO_MAX_LINES];
+  // With sysfs, one value file per line; with the character device,
+  //  a single line request covers all the lines
+  int fds[GPIO_MAX_LINES];
+  int req_fd;
+  // Last level written to each line, or -1 if unknown
+  int levels[GPIO_MAX_LINES];
+  } GPIO;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Root of the sysfs GPIO tree. This can be pointed somewhere else, 
+//  e.g., for testing against a fake directory tree
+extern const char *gpio_sysfs_root;
+
 BOOL gpio_export (int pin);
 BOOL gpio_set_direction (int pin, GPIODirection direction);
 BOOL gpio_set_pin (int pin, GPIOLevel level);
 
+// Export the specified pins, set them as outputs, and open their value
+//  files. Returns NULL if any of this fails
+GPIO *gpio_open (const int *pins, int n);
+// Request the specified lines, as outputs, from a GPIO character 
+//  device such as /dev/gpiochip0. Pins are line offsets on that chip
+GPIO *gpio_open_chip (const char *chip, const int *pins, int n);
+// Set a line, specified by its index, to the specified level. Nothing
+//  is written if the line is already known to be at that level
+BOOL gpio_set (GPIO *self, int line, GPIOLevel level);
+// Set several lines at once. Bit i of mask selects line i, and bit i of
+//  values gives its level. With the character device backend, this is
+//  a single ioctl()
+BOOL gpio_set_multi (GPIO *self, uint32_t mask, uint32_t values);
+void gpio_close (GPIO *self);
+
 #ifdef __clplusplus
 }
 #endif
@@ -0,0 +1,60 @@
+/*========================================================================
+  spi-oled
+  kernels.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+========================================================================*/
+#pragma once
+
+#include <stdint.h>
+#include "defs.h"
+
+// A set of implementations of the bulk buffer operations used by the 
+//  drawing and flushing code. There is a plain C version, which is the 
+//  reference, and vectorized versions for NEON, SSE2, and AVX2. The best
+//  one that the CPU supports is chosen the first time kernels() is 
+//  called. Setting the environment variable SPI_OLED_KERNELS to the name
+//  of a set forces that set to be used, if it is available
+typedef struct _Kernels
+  {
+  const char *name;
+  // Set n bytes at dst to value
+  void (*fill) (uint8_t *dst, uint8_t value, int n);
+  // Set 'rows' runs of n bytes, each 'stride' bytes apart, to value
+  void (*fill_rect) (uint8_t *dst, int stride, int n, int rows, 
+         uint8_t value);
+  // Copy n bytes from src to dst, which must not overlap
+  void (*copy) (uint8_t *dst, const uint8_t *src, int n);
+  // Find the first differing byte, and one past the last, in two 
+  //  n-byte buffers. Returns FALSE if they are identical
+  BOOL (*diff) (const uint8_t *a, const uint8_t *b, int n, 
+         int *first, int *last);
+  } Kernels;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The most kernel sets that can be available on one CPU
+#define KERNELS_MAX_SETS 4
+
+// Get the kernel set in use
+const Kernels *kernels (void);
+
+// Fill 'sets' with the kernel sets that this build and CPU support, 
+//  best first, and return how many there are. The last is always the 
+//  reference set. 'sets' must have room for KERNELS_MAX_SETS
+int kernels_available (const Kernels **sets);
+
+// The plain C reference kernels
+extern const Kernels kernels_scalar;
+
+// Check a kernel set against the reference kernels, using buffers of
+//  various sizes and alignments. Returns TRUE if all the results are
+//  bit-exact
+BOOL kernels_verify (const Kernels *k);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,48 @@
+/*========================================================================
+  spi-oled
+  seg7.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+========================================================================*/
+#pragma once
+
+#include "defs.h"
+#include "atlas.h"
+
+// Number of slots in the 7-segment glyph cache. A collision simply 
+//  replaces the older glyph
+#define SEG7_CACHE_SLOTS 32
+
+// A 7-segment character, rasterized once for a particular height and
+//  segment thickness into a nibble mask. The mask is held as a one-glyph
+//  atlas, so it is drawn by atlas_blit(), a byte at a time, in any 
+//  colour. 'width' is the space the character takes up, not counting 
+//  the gap after it
+typedef struct _Seg7Glyph
+  {
+  int height;
+  int thickness;
+  char c;
+  int width;
+  Atlas atlas;
+  AtlasGlyph glyph;
+  uint8_t *mask;
+  int capacity; // Bytes allocated for mask
+  } Seg7Glyph;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Get the rasterized glyph for character c, which can be a hex digit 
+//  (either case), '-', ':', '.', or ' '. Returns NULL for any other 
+//  character. The glyph remains valid until the next call
+const Seg7Glyph *seg7_get (int height, int thickness, char c);
+
+// Empty the cache, and free the memory it uses
+void seg7_cache_clear (void);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,91 @@
+/*========================================================================
+  spi-oled
+  span.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+========================================================================*/
+#pragma once
+
+#include <stdint.h>
+#include "defs.h"
+#include "surface.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// These functions fill runs of pixels in a nibble-packed 4bpp buffer, in
+//  which each row is 'stride' bytes long, and the even-numbered pixel of
+//  each pair is in the high nibble. End coordinates are exclusive. There
+//  is no bounds checking -- callers must clip first
+
+// Set the single pixel x,y. This is the unchecked inner-loop version of
+//  spi_oled_set_pixel() -- it neither clips nor marks damage
+static inline void span_pixel (uint8_t *buffer, int stride, int x, int y, 
+      uint8_t colour)
+  {
+  uint8_t *p = buffer + y * stride + x / 2;
+  if (x & 1)
+    *p = (*p & 0xF0) | (colour & 0x0F);
+  else
+    *p = (*p & 0x0F) | (colour << 4);
+  }
+
+// Get the colour of pixel x,y
+static inline uint8_t span_get (const uint8_t *buffer, int stride, int x, 
+      int y)
+  {
+  uint8_t b = buffer[y * stride + x / 2];
+  return x & 1 ? b & 0x0F : b >> 4;
+  }
+
+// Fill pixels x1 to x2 of row y
+void span_hline (uint8_t *buffer, int stride, int x1, int x2, int y, 
+      uint8_t colour);
+
+// Fill pixels y1 to y2 of column x
+void span_vline (uint8_t *buffer, int stride, int x, int y1, int y2, 
+      uint8_t colour);
+
+// Fill the rectangle x1,y1 to x2,y2
+void span_fill_rect (uint8_t *buffer, int stride, int x1, int y1, 
+      int x2, int y2, uint8_t colour);
+
+// Combine the rectangle x1,y1 to x2,y2 with colour, using a raster
+//  operation. SPI_OLED_ROP_KEY has no meaning for a single colour, and
+//  is the same as SPI_OLED_ROP_COPY
+void span_fill_rect_rop (uint8_t *buffer, int stride, int x1, int y1, 
+      int x2, int y2, uint8_t colour, SPIOledRop rop);
+
+// Copy the w x h rectangle at sx,sy of src to dx,dy of dst. The two
+//  must not overlap
+void span_copy_rect (uint8_t *dst, int dst_stride, int dx, int dy, 
+      const uint8_t *src, int src_stride, int sx, int sy, int w, int h);
+
+// Combine the w x h rectangle at sx,sy of src with the rectangle at
+//  dx,dy of dst, using a raster operation. For SPI_OLED_ROP_KEY, source
+//  pixels of colour 'key' are not copied
+void span_rop_rect (uint8_t *dst, int dst_stride, int dx, int dy, 
+      const uint8_t *src, int src_stride, int sx, int sy, int w, int h,
+      SPIOledRop rop, uint8_t key);
+
+// span_blend_table[alpha][over][under] is the colour 'over' laid on 
+//  'under' with opacity alpha/15, rounded to the nearest level. It is 
+//  shared by anti-aliased text and translucent layers, and is filled in
+//  by span_blend_init(), which must be called before span_blend()
+extern uint8_t span_blend_table[16][16][16];
+
+// Fill in span_blend_table, if that hasn't been done already
+void span_blend_init (void);
+
+// Lay colour 'over' on 'under' with opacity alpha/15
+static inline uint8_t span_blend (uint8_t alpha, uint8_t over, 
+      uint8_t under)
+  {
+  return span_blend_table[alpha][over][under];
+  }
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -10,6 +10,19 @@
 #include <stdint.h>
 #include "defs.h"
 
+// The spidev driver rejects any message whose total size exceeds its
+//  'bufsiz' module parameter. This is the value assumed if the
+//  parameter cannot be read from sysfs
+#define SPI_DEFAULT_BUFSIZ 4096
+
+// Maximum number of transfers packed into one SPI_IOC_MESSAGE() ioctl.
+//  The ioctl encoding limits this to 511; 128 is one per panel row
+#define SPI_MAX_TRANSFERS 128
+
+// The kernel rounds each transfer in a message up to its DMA alignment
+//  when checking the total against bufsiz. 128 is the worst case
+#define SPI_TRANSFER_ALIGN 128
+
 typedef enum 
   {
   SPI_MODE0 = SPI_MODE_0,  /*!< CPOL = 0, CPHA = 0 */
@@ -41,6 +54,7 @@ typedef struct _SPI
   int speed; // bits per sec
   int delay; // In usec
   struct spi_ioc_transfer tr;
+  int max_block; // Largest message the spidev driver will accept, in bytes
   } SPI;
 
 #ifdef __cplusplus
@@ -56,8 +70,22 @@ int spi_set_bit_order (SPI *self, SPIBitOrder order);
 int spi_set_speed (SPI *self, int speed);
 int spi_set_speed (SPI *self, int speed);
 int spi_set_data_interval (SPI *self, int interval);
+
+// The write functions are TX-only: nothing is read back from the device
+//  and the data to be sent is never modified. Each returns 0 on success
+//  and -1 if the ioctl() fails
+
+// Write a single byte. Returns 0 or -1, as above -- not a byte read
+//  back from the device
 int spi_write_byte (SPI *self, uint8_t value);
-int spi_write_bytes (SPI *self, uint8_t *buf, int n);
+
+// Write n bytes from buf in one transfer
+int spi_write_bytes (SPI *self, const uint8_t *buf, int n);
+
+// Write 'rows' blocks of row_len bytes, each 'stride' bytes apart in buf,
+//  using as few ioctl() calls as the spidev driver allows
+int spi_write_rows (SPI *self, const uint8_t *buf, int row_len, int stride, 
+      int rows);
 
 #ifdef __clplusplus
 }
@@ -13,9 +13,21 @@
 #define OLED_RST  25
 #define OLED_DC   24
 
+// The GPIO character device that the pins above belong to
+#define OLED_GPIOCHIP "/dev/gpiochip0"
+
+// Indices of the control lines in the SPIOled's GPIO object
+#define OLED_LINE_CS  0
+#define OLED_LINE_DC  1
+#define OLED_LINE_RST 2
+#define OLED_BIT_CS   (1U << OLED_LINE_CS)
+#define OLED_BIT_DC   (1U << OLED_LINE_DC)
+
 #include "debug.h"
 #include "spi.h"
+#include "gpio.h"
 #include "fonts.h"
+#include "surface.h"
 
 #define COLOUR_BLACK 0
 #define COLOUR_WHITE 0x0F
@@ -33,9 +45,47 @@ typedef enum
   } SPIOledScanDir;
 #define SCAN_DIR_DFT  L2R_U2D 
 
+// How flush() decides what to send. SPI_OLED_FLUSH_DAMAGE sends the
+//  rectangle covering everything drawn since the last flush. 
+//  SPI_OLED_FLUSH_DIFF keeps a copy of what the panel is showing, and
+//  sends only the parts of that rectangle that have actually changed.
+//  This costs a frame-sized allocation and a comparison at each flush, 
+//  but catches redraws that don't change anything
+typedef enum
+  {
+  SPI_OLED_FLUSH_DAMAGE = 0,
+  SPI_OLED_FLUSH_DIFF
+  } SPIOledFlushMode;
+
+// Approximate cost of setting up a panel window, expressed as the number
+//  of data bytes that could be sent in the same time. In diff mode, 
+//  changed rows are merged into one window unless that would send more
+//  than this many extra bytes
+#define SPI_OLED_WINDOW_COST 64
+
+// Maximum depth of the clip rectangle stack
+#define SPI_OLED_CLIP_DEPTH 8
+
+// Maximum depth of the saved region stack. The regions on the stack can
+//  total, at most, one full screen
+#define SPI_OLED_REGION_DEPTH 8
+
+// Polygons with up to this many edges are filled without allocating 
+//  memory
+#define SPI_OLED_POLYGON_EDGES 32
+
+// A vertex of a polygon
+typedef struct _SPIOledPoint
+  {
+  int x;
+  int y;
+  } SPIOledPoint;
+
 typedef struct _SPIOled 
   {
   SPI *spi;
+  // The CS, DC, and RST control lines, opened once at init time
+  GPIO *gpio;
   // Scan direction -- the way in which the frame buffer is read into
   //  the panel using SPI
   SPIOledScanDir scan_dir;
@@ -57,6 +107,36 @@ typedef struct _SPIOled
   // ready is set to TRUE when the panel seems to be ready to accept data
   // We use this to determine whether it is safe to update the panel
   BOOL ready;
+  // The panel write window last set by flush(), as xstart, ystart,
+  //  xend, yend. If window_valid is TRUE, the panel's address pointer is
+  //  known to be at the start of this window
+  uint16_t window[4];
+  BOOL window_valid;
+  // The frame buffer as a surface. Its damage rectangle is the part of
+  //  the buffer that has changed since the last flush
+  SPIOledSurface screen;
+  // Where drawing operations go -- &screen, or an off-screen surface
+  SPIOledSurface *target;
+  SPIOledFlushMode flush_mode;
+  // In SPI_OLED_FLUSH_DIFF mode, a copy of what the panel is showing,
+  //  in the same layout as buffer. Otherwise NULL
+  uint8_t *shadow;
+  // The clip rectangle, x2 and y2 exclusive. Drawing operations have no
+  //  effect outside it. It is always within the drawing target
+  int clip_x1;
+  int clip_y1;
+  int clip_x2;
+  int clip_y2;
+  // Clip rectangles saved by spi_oled_push_clip()
+  int clip_stack[SPI_OLED_CLIP_DEPTH][4];
+  int clip_depth;
+  // Regions of the screen saved by spi_oled_push_region(). Their
+  //  contents are stacked in region_arena, which is the size of the
+  //  frame buffer; region_used bytes of it are in use
+  int region_stack[SPI_OLED_REGION_DEPTH][4];
+  int region_depth;
+  uint8_t *region_arena;
+  int region_used;
   } SPIOled;
 
 
@@ -70,6 +150,12 @@ extern "C" {
 //  further panel-related methods
 SPIOled *spi_oled_init (const char *dev, int width, int height);
 
+// As spi_oled_init(), but specifying how the GPIO control lines are
+//  driven. spi_oled_init() uses GPIO_BACKEND_AUTO, which prefers the
+//  GPIO character device, and falls back to sysfs if it is unavailable
+SPIOled *spi_oled_init_with_backend (const char *dev, int width, int height,
+      GPIOBackend backend);
+
 // Close the SPI device, clear memory and, optionally, power off the panel
 void spi_oled_close (SPIOled *self, BOOL panel_off);
 
@@ -82,11 +168,78 @@ void spi_oled_clear (SPIOled* self, uint8_t colour);
 void spi_oled_set_pixel (SPIOled *self, uint16_t x, uint16_t y, 
   uint8_t colour);
 
-// Flush the entire framebuffer to the panel. Note that noe of the 
+// Restrict drawing to the intersection of the current clip rectangle and 
+//  x1,y1 to x2,y2 (exclusive). The previous clip rectangle is saved, and
+//  restored by spi_oled_pop_clip(). Returns FALSE, and leaves the clip
+//  rectangle unchanged, if the stack is full
+BOOL spi_oled_push_clip (SPIOled *self, int x1, int y1, int x2, int y2);
+
+// Restore the clip rectangle saved by the last spi_oled_push_clip()
+void spi_oled_pop_clip (SPIOled *self);
+
+// Save the contents of the screen from x1,y1 to x2,y2 (exclusive), for
+//  example before drawing a popup over it. The x values are widened to 
+//  whole bytes. Returns FALSE, and saves nothing, if the stack is full,
+//  or there isn't room in it for the region
+BOOL spi_oled_push_region (SPIOled *self, int x1, int y1, int x2, int y2);
+
+// Put back the region saved by the last spi_oled_push_region(), and
+//  mark it as needing to be flushed. This is a copy of the saved rows,
+//  with no redrawing
+void spi_oled_pop_region (SPIOled *self);
+
+// Flush the framebuffer to the panel. Note that none of the 
 //  other drawing methods have any effect on the display until flush()
-//  is called
+//  is called. Only the part of the framebuffer that has been drawn on
+//  since the last flush is sent
 void spi_oled_flush (SPIOled* self);
 
+// Select how flush() works out what to send -- see SPIOledFlushMode.
+//  Any pending changes are flushed first
+void spi_oled_set_flush_mode (SPIOled *self, SPIOledFlushMode mode);
+
+// Mark the area x1,y1 to x2,y2 (exclusive) of the drawing target as 
+//  changed -- on the screen, as needing to be flushed. The drawing 
+//  methods do this automatically; this method is only needed if the 
+//  buffer is modified directly
+void spi_oled_mark_dirty (SPIOled *self, int x1, int y1, int x2, int y2);
+
+// Mark the whole framebuffer as needing to be flushed
+void spi_oled_invalidate (SPIOled *self);
+
+// Direct all drawing operations, including spi_oled_clear(), to an 
+//  off-screen surface, or back to the screen if surface is NULL. The 
+//  clip rectangle is reset to the whole of the new target, and the clip
+//  stack is emptied
+void spi_oled_set_target (SPIOled *self, SPIOledSurface *surface);
+
+// Copy the w x h rectangle at sx,sy of surface src to dx,dy of the 
+//  drawing target, within the clip rectangle. If src is the drawing 
+//  target, nothing is drawn, and the call is logged. Rows are copied a 
+//  byte at a time, even when the source and destination pixels are in 
+//  different halves of their bytes
+void spi_oled_blit (SPIOled *self, const SPIOledSurface *src, int sx, 
+      int sy, int w, int h, int dx, int dy);
+
+// As spi_oled_blit(), but combining the source with the target using a
+//  raster operation. With SPI_OLED_ROP_XOR, blitting a cursor or 
+//  highlight a second time erases it, with nothing saved. With
+//  SPI_OLED_ROP_KEY, source pixels of colour 'key' are transparent, 
+//  for sprites. 'key' is ignored by the other operations
+void spi_oled_blit_rop (SPIOled *self, const SPIOledSurface *src, int sx, 
+      int sy, int w, int h, int dx, int dy, SPIOledRop rop, uint8_t key);
+
+// Combine the rectangle x1,y1 to x2,y2 (exclusive) of the drawing target
+//  with colour, within the clip rectangle. SPI_OLED_ROP_XOR with 
+//  COLOUR_WHITE inverts the rectangle. SPI_OLED_ROP_KEY is treated as 
+//  SPI_OLED_ROP_COPY
+void spi_oled_fill_rect_rop (SPIOled *self, int x1, int y1, int x2, int y2,
+      uint8_t colour, SPIOledRop rop);
+
+// Send a sequence of command bytes to the panel controller in a single
+//  transaction, with DC and CS set only once
+void spi_oled_write_cmds (SPIOled *self, const uint8_t *cmds, int n);
+
 // Turn the panel on. Any data that was previous written remains in place,
 //  unless the panel is specifically cleared
 void spi_oled_on (SPIOled *self);
@@ -106,24 +259,100 @@ void spi_oled_draw_rect (SPIOled *self, uint16_t x1, uint16_t y1,
 void spi_oled_draw_square (SPIOled *self, uint16_t x1, uint16_t y1, 
       uint16_t length, uint8_t colour, BOOL fill);
 
-// Draw a single ASCII character, whose top-left corner is x,y
+// Draw a single character, whose top-left corner is x,y. c is taken as
+//  a byte value, that is, ASCII or Latin-1 -- use 
+//  spi_oled_draw_codepoint() for anything else
 void spi_oled_draw_char (SPIOled *self, uint16_t x, uint16_t y, 
     const sFONT *font, char c, uint8_t colour);
 
-// Draw a string of ASCII characters, whose top-left corner is x,y
+// Draw a UTF-8 string, whose top-left corner is x,y. Characters that
+//  the font doesn't have take up a cell but draw nothing, and bytes that
+//  aren't valid UTF-8 are drawn as U+FFFD, if the font has it.
 // Note that there is no wrapping -- text that will not fit the
 //  screen is truncated
 void spi_oled_draw_string (SPIOled *self, uint16_t x, uint16_t y, 
     const sFONT *font, const char *s, uint8_t colour);
 
+// Draw a single character in colour fg, filling the rest of the 
+//  character box with colour bg. This replaces the text in one pass, 
+//  without having to erase it first
+void spi_oled_draw_char_opaque (SPIOled *self, uint16_t x, uint16_t y, 
+    const sFONT *font, char c, uint8_t fg, uint8_t bg);
+
+// Draw a UTF-8 string, with the same background filling as 
+//  spi_oled_draw_char_opaque()
+void spi_oled_draw_string_opaque (SPIOled *self, uint16_t x, uint16_t y, 
+    const sFONT *font, const char *s, uint8_t fg, uint8_t bg);
+
+// Draw the character with Unicode code point c. Fonts generated by
+//  tools/fontc from BDF files can have any characters; the built-in
+//  fonts have only ASCII
+void spi_oled_draw_codepoint (SPIOled *self, uint16_t x, uint16_t y, 
+    const sFONT *font, uint32_t c, uint8_t colour);
+
+// Draw the character with Unicode code point c, with the same background
+//  filling as spi_oled_draw_char_opaque()
+void spi_oled_draw_codepoint_opaque (SPIOled *self, uint16_t x, uint16_t y, 
+    const sFONT *font, uint32_t c, uint8_t fg, uint8_t bg);
+
 // Draw a 7-segment-style digit with top-left corner x,y, or specified
-//  width, heigh, and thickness. Note that this function can only
-//  draw digits, and the 'val' argument is a number between zero and
-//  one, not a character
+//  height and thickness. The digit is height/2 + thickness pixels wide,
+//  and height + thickness high. Note that the 'val' argument is a number
+//  between 0 and 15, not a character -- 10 to 15 are drawn as A to F.
+//  Each character is rasterized once for each size, and cached, so 
+//  redrawing a digit is a copy
 void spi_oled_draw_7seg_digit (SPIOled *self, uint16_t x, uint16_t y, 
       uint16_t height, int thickness, int val, uint8_t colour);
 
-// Draw a line of specified pixel thickness between x1,x2 and y1,y2
+// Draw a string of 7-segment characters, separated by gaps of one 
+//  segment thickness. The string can contain hex digits, in either 
+//  case, '-', ' ', and ':' and '.', which are narrow. Other characters 
+//  are ignored
+void spi_oled_draw_7seg_string (SPIOled *self, uint16_t x, uint16_t y, 
+      uint16_t height, int thickness, const char *s, uint8_t colour);
+
+// Draw a string of 7-segment characters, filling the segments that are
+//  off, and the gaps, with colour bg. This replaces a changing value 
+//  without having to erase it first
+void spi_oled_draw_7seg_string_opaque (SPIOled *self, uint16_t x, 
+      uint16_t y, uint16_t height, int thickness, const char *s, 
+      uint8_t fg, uint8_t bg);
+
+// Draw a circle of radius r centred on cx,cy. The centre can be off the
+//  screen. A filled circle is drawn as one span per row
+void spi_oled_draw_circle (SPIOled *self, int cx, int cy, int r, 
+      uint8_t colour, BOOL fill);
+
+// Draw an ellipse of radii rx (horizontal) and ry (vertical), centred
+//  on cx,cy
+void spi_oled_draw_ellipse (SPIOled *self, int cx, int cy, int rx, int ry,
+      uint8_t colour, BOOL fill);
+
+// Draw the part of a circle from angle 'start' to angle 'end', in 
+//  degrees clockwise from 3 o'clock. end must be greater than start; a
+//  range of 360 degrees or more is the whole circle. If fill is TRUE, 
+//  the arc is a filled pie slice
+void spi_oled_draw_arc (SPIOled *self, int cx, int cy, int r, int start,
+      int end, uint8_t colour, BOOL fill);
+
+// Fill the part of the ring between radii r1 and r2 (inclusive) from 
+//  angle 'start' to angle 'end', as for spi_oled_draw_arc(). This is 
+//  the band of a gauge; with r1 zero, it is a pie slice
+void spi_oled_fill_ring (SPIOled *self, int cx, int cy, int r1, int r2, 
+      int start, int end, uint8_t colour);
+
+// Fill the polygon with n vertices. The last vertex joins up with the
+//  first. A pixel is filled if its centre is inside the polygon, by the
+//  even-odd rule, so polygons that share an edge don't overlap. The 
+//  polygon can be concave or self-intersecting, and partly off the 
+//  screen. It is filled a span at a time
+void spi_oled_fill_polygon (SPIOled *self, const SPIOledPoint *points, 
+      int n, uint8_t colour);
+
+// Draw a line of specified pixel thickness between x1,x2 and y1,y2.
+//  A thick line extends 'thickness' pixels right of and below the 
+//  single-pixel line. Each row of the line is filled as one span, and 
+//  horizontal and vertical lines as rectangles
 void spi_oled_draw_line (SPIOled *self, uint16_t x1, uint16_t y1, 
       uint16_t x2, uint16_t y2, int thickness, uint8_t colour);
 
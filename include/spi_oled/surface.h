@@ -0,0 +1,68 @@
+/*========================================================================
+  spi-oled
+  surface.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+========================================================================*/
+#pragma once
+
+#include <stdint.h>
+#include "defs.h"
+
+// A surface is a 4bpp image in the same nibble-packed layout as the 
+//  frame buffer: each row is 'stride' bytes, and the even-numbered pixel
+//  of each pair is in the high nibble. The screen itself is a surface, 
+//  and so is anything drawn off-screen with spi_oled_set_target(), so
+//  that it can be blitted to the screen, or to other surfaces, later.
+//  Each surface keeps its own damage rectangle, in the same way as the
+//  screen -- x2 and y2 exclusive, x values even, and empty when 
+//  x1 >= x2
+typedef struct _SPIOledSurface
+  {
+  uint8_t *buffer;
+  int width;  // Pixels
+  int height; // Pixels
+  int stride; // Bytes
+  int dirty_x1;
+  int dirty_y1;
+  int dirty_x2;
+  int dirty_y2;
+  } SPIOledSurface;
+
+// How a blit or fill combines each source pixel with the pixel it lands
+//  on. The bitwise operations work on the 4-bit colour values; drawing
+//  the same thing twice with XOR restores what was there. KEY copies the
+//  source, except for pixels of the key colour, which are left alone
+typedef enum
+  {
+  SPI_OLED_ROP_COPY = 0,
+  SPI_OLED_ROP_XOR,
+  SPI_OLED_ROP_OR,
+  SPI_OLED_ROP_AND,
+  SPI_OLED_ROP_KEY
+  } SPIOledRop;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Create a surface, initially all colour 0, and with no damage
+SPIOledSurface *spi_oled_surface_new (int width, int height);
+
+void spi_oled_surface_free (SPIOledSurface *self);
+
+// Extend the damage rectangle to cover x1,y1 to x2,y2 (exclusive), 
+//  within the surface
+void spi_oled_surface_mark_dirty (SPIOledSurface *self, int x1, int y1, 
+      int x2, int y2);
+
+// Mark the whole surface as damaged
+void spi_oled_surface_invalidate (SPIOledSurface *self);
+
+// Set the damage rectangle to empty
+void spi_oled_surface_clear_dirty (SPIOledSurface *self);
+
+#ifdef __cplusplus
+}
+#endif
+
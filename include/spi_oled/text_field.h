@@ -0,0 +1,53 @@
+/*========================================================================
+  spi-oled
+  text_field.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+========================================================================*/
+#pragma once
+
+#include "spi_oled.h"
+
+// A TextField is a fixed-width run of character cells at a fixed 
+//  position, drawn opaquely. It remembers what it last drew, so that 
+//  setting new text redraws only the cells whose characters have 
+//  changed -- and, since drawing marks damage, only those cells are
+//  flushed. For a clock, that is usually just the last digit
+typedef struct _TextField
+  {
+  int x;
+  int y;
+  const sFONT *font;
+  int width; // Characters
+  uint8_t fg;
+  uint8_t bg;
+  // The code points currently drawn, width long. Not null-terminated
+  uint32_t *cells;
+  // FALSE until the first draw, or after text_field_invalidate()
+  BOOL drawn;
+  } TextField;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Create a text field 'width' characters wide, with its top-left corner
+//  at x,y. Nothing is drawn until text_field_set() is called
+TextField *text_field_new (int x, int y, const sFONT *font, int width, 
+      uint8_t fg, uint8_t bg);
+
+void text_field_free (TextField *self);
+
+// Draw the UTF-8 text into the field, redrawing only the cells that have
+//  changed. Text longer than the field is truncated, and shorter text
+//  is padded with spaces. Returns the number of cells redrawn
+int text_field_set (TextField *self, SPIOled *oled, const char *s);
+
+// Force the whole field to be redrawn by the next text_field_set() -- for
+//  example, after something else has been drawn over it
+void text_field_invalidate (TextField *self);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,83 @@
+/*========================================================================
+  spi-oled
+  text_layout.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+========================================================================*/
+#pragma once
+
+#include "spi_oled.h"
+
+// The most lines a layout can have. Text that needs more is cut off
+//  with an ellipsis, as it is when it doesn't fit the box
+#define TEXT_LAYOUT_MAX_LINES 16
+
+// Number of slots in the layout cache. A collision simply replaces the
+//  older layout
+#define TEXT_LAYOUT_CACHE_SLOTS 32
+
+typedef enum
+  {
+  TEXT_ALIGN_LEFT = 0,
+  TEXT_ALIGN_CENTRE,
+  TEXT_ALIGN_RIGHT
+  } TextAlign;
+
+// One laid-out line: 'length' bytes of the string, starting at byte
+//  'start', which are 'chars' characters. If ellipsis is TRUE, the
+//  line is followed by an ellipsis, which is included in 'chars'
+typedef struct _TextLine
+  {
+  int start;
+  int length;
+  int chars;
+  int x;
+  int y;
+  BOOL ellipsis;
+  } TextLine;
+
+// A UTF-8 string laid out into the box x,y,w,h: broken into lines at
+//  spaces (or, for a word longer than the box, within the word) and at
+//  newlines, and each line aligned within the box. x1,y1 to x2,y2
+//  (exclusive) bounds the text that will actually be drawn
+typedef struct _TextLayout
+  {
+  // The cache key
+  char *text;
+  const sFONT *font;
+  int box_x, box_y, box_w, box_h;
+  TextAlign align;
+  uint32_t hash;
+  // The layout
+  int n_lines;
+  TextLine lines[TEXT_LAYOUT_MAX_LINES];
+  int x1, y1, x2, y2;
+  } TextLayout;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Lay out the string s in the box x,y,w,h. The result is cached, keyed
+//  on the string's contents, the font, the box, and the alignment, so
+//  laying out the same paragraph again on a later frame costs only a
+//  hash and a string comparison. The layout remains valid until a call
+//  that lays out different text into the same cache slot. Returns NULL,
+//  which text_layout_draw() ignores, if s is NULL or there is no memory
+//  for a copy of it; nothing is cached then
+const TextLayout *text_layout (const char *s, const sFONT *font,
+      int x, int y, int w, int h, TextAlign align);
+
+// Draw a layout. If opaque is TRUE, each line is drawn with its
+//  background filled, as spi_oled_draw_string_opaque() does, but the
+//  rest of the box is not touched
+void text_layout_draw (const TextLayout *layout, SPIOled *oled,
+      uint8_t fg, uint8_t bg, BOOL opaque);
+
+// Empty the layout cache, and free the memory it uses
+void text_layout_cache_clear (void);
+
+#ifdef __cplusplus
+}
+#endif
+
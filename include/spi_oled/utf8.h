@@ -0,0 +1,75 @@
+/*========================================================================
+  spi-oled
+  utf8.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+========================================================================*/
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The code point drawn for bytes that aren't valid UTF-8
+#define UTF8_REPLACEMENT 0xFFFD
+
+// Decode the UTF-8 character at *s, and advance *s past it. A byte that
+//  does not start a valid sequence -- a stray continuation byte, a
+//  truncated or overlong sequence, a surrogate, or anything above
+//  U+10FFFF -- decodes to UTF8_REPLACEMENT and advances *s by one byte
+//  only, so decoding always resynchronizes at the next character. The
+//  caller must stop at the terminating zero; this function never reads
+//  past it
+static inline uint32_t utf8_next (const char **s)
+  {
+  const uint8_t *p = (const uint8_t *)*s;
+  uint32_t c = p[0];
+  int n;
+  uint32_t min;
+  if (c < 0x80)
+    {
+    *s += 1;
+    return c;
+    }
+  else if ((c & 0xE0) == 0xC0)
+    {
+    n = 1; min = 0x80; c &= 0x1F;
+    }
+  else if ((c & 0xF0) == 0xE0)
+    {
+    n = 2; min = 0x800; c &= 0x0F;
+    }
+  else if ((c & 0xF8) == 0xF0)
+    {
+    n = 3; min = 0x10000; c &= 0x07;
+    }
+  else
+    {
+    *s += 1;
+    return UTF8_REPLACEMENT;
+    }
+
+  for (int i = 1; i <= n; i++)
+    {
+    // The terminating zero fails this test too
+    if ((p[i] & 0xC0) != 0x80)
+      {
+      *s += 1;
+      return UTF8_REPLACEMENT;
+      }
+    c = (c << 6) | (p[i] & 0x3F);
+    }
+  if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF))
+    {
+    *s += 1;
+    return UTF8_REPLACEMENT;
+    }
+  *s += n + 1;
+  return c;
+  }
+
+#ifdef __cplusplus
+}
+#endif
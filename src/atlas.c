@@ -0,0 +1,236 @@
+/*========================================================================
+  spi-oled
+  atlas.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Drawing glyphs from the atlases generated by tools/fontc. Glyphs are
+  drawn from rows of nibble masks in the frame buffer's own layout, so
+  a glyph is written a byte -- two pixels -- at a time. When the glyph
+  lands on an odd pixel, each output byte is assembled from two mask
+  nibbles with a shift. A 1bpp atlas row is first expanded to masks, 
+  two pixels at a time, through a four-entry table; that is a few
+  operations per byte of the glyph, against a quarter of the storage.
+
+  Anti-aliased glyphs use the same layout, but the nibbles are coverage
+  levels. They are blended through a lookup table of every combination
+  of coverage, foreground, and existing pixel -- the 4k span_blend_table,
+  built on first use and shared with the compositor -- so blending a
+  pixel is a table read, not arithmetic
+========================================================================*/
+#include <stddef.h>
+#include <spi_oled/atlas.h>
+#include <spi_oled/span.h>
+
+const AtlasGlyph *atlas_glyph (const Atlas *atlas, uint32_t c)
+  {
+  if (c >= atlas->limit) return NULL;
+  uint16_t page = atlas->pages[c >> 8];
+  if (page == ATLAS_NO_GLYPH) return NULL;
+  uint16_t glyph = atlas->index[page * 256 + (c & 0xFF)];
+  if (glyph == ATLAS_NO_GLYPH) return NULL;
+  return &atlas->glyphs[glyph];
+  }
+
+
+/* Write mask nibble 'column' of the mask row m to pixel x of the buffer
+ * row d */
+static inline void atlas_nibble (uint8_t *d, int x, const uint8_t *m,
+      int column, uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  uint8_t bit = column & 1 ? m[column / 2] & 0x0F : m[column / 2] & 0xF0;
+  if (bit)
+    span_pixel (d, 0, x, 0, fg);
+  else if (opaque)
+    span_pixel (d, 0, x, 0, bg);
+  }
+
+
+/* Write columns c1 to c2 of a mask row m, whose column 0 is at pixel x
+ * of buffer row d. The odd pixels at the ends are written singly;
+ * everything between is whole bytes */
+static void atlas_row (uint8_t *d, int x, const uint8_t *m, int c1, int c2,
+      uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  uint8_t f = (fg & 0x0F) * 0x11;
+  uint8_t b = (bg & 0x0F) * 0x11;
+  int c = c1;
+  if ((x + c) & 1)
+    {
+    atlas_nibble (d, x + c, m, c, fg, bg, opaque);
+    c++;
+    }
+  uint8_t *p = d + (x + c) / 2;
+  if (c & 1)
+    {
+    // The atlas nibbles are out of step with the buffer's by one
+    for (; c + 1 < c2; c += 2, p++)
+      {
+      uint8_t s = (m[c / 2] << 4) | (m[c / 2 + 1] >> 4);
+      *p = opaque ? (f & s) | (b & ~s) : (*p & ~s) | (f & s);
+      }
+    }
+  else
+    {
+    for (; c + 1 < c2; c += 2, p++)
+      {
+      uint8_t s = m[c / 2];
+      *p = opaque ? (f & s) | (b & ~s) : (*p & ~s) | (f & s);
+      }
+    }
+  if (c < c2)
+    atlas_nibble (d, x + c, m, c, fg, bg, opaque);
+  }
+
+
+// atlas_bits[b] is the mask byte for two pixels whose bits are b
+static const uint8_t atlas_bits[4] = { 0x00, 0x0F, 0xF0, 0xFF };
+
+/* Expand the 1bpp row r into the mask row m, for columns c1 to c2. The
+ * whole bytes of r that hold those columns are expanded, so that 
+ * atlas_row() can read the mask nibbles either side of them */
+static void atlas_expand_row (uint8_t *m, const uint8_t *r, int c1, int c2)
+  {
+  for (int i = c1 / 8; i <= (c2 - 1) / 8; i++)
+    {
+    uint8_t b = r[i];
+    uint8_t *p = m + i * 4;
+    p[0] = atlas_bits[b >> 6];
+    p[1] = atlas_bits[(b >> 4) & 3];
+    p[2] = atlas_bits[(b >> 2) & 3];
+    p[3] = atlas_bits[b & 3];
+    }
+  }
+
+
+/* Blend two pixels of coverage s into the byte at p. Bytes with no 
+ * coverage, and bytes with full coverage, take a short cut */
+static inline void atlas_blend_byte (uint8_t *p, uint8_t s, uint8_t fg, 
+      uint8_t bg, BOOL opaque)
+  {
+  if (s == 0)
+    {
+    if (opaque) *p = (bg << 4) | bg;
+    return;
+    }
+  if (s == 0xFF)
+    {
+    *p = (fg << 4) | fg;
+    return;
+    }
+  uint8_t u1 = opaque ? bg : *p >> 4;
+  uint8_t u2 = opaque ? bg : *p & 0x0F;
+  *p = (span_blend (s >> 4, fg, u1) << 4) | span_blend (s & 0x0F, fg, u2);
+  }
+
+
+/* Blend one pixel, from mask nibble 'column' of the mask row m, into 
+ * pixel x of the buffer row d */
+static inline void atlas_blend_nibble (uint8_t *d, int x, const uint8_t *m,
+      int column, uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  uint8_t a = column & 1 ? m[column / 2] & 0x0F : m[column / 2] >> 4;
+  uint8_t *p = d + x / 2;
+  uint8_t u = opaque ? bg : (x & 1 ? *p & 0x0F : *p >> 4);
+  if (a || opaque)
+    span_pixel (d, 0, x, 0, span_blend (a, fg, u));
+  }
+
+
+/* As atlas_row(), for a coverage atlas */
+static void atlas_row_coverage (uint8_t *d, int x, const uint8_t *m, 
+      int c1, int c2, uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  int c = c1;
+  if ((x + c) & 1)
+    {
+    atlas_blend_nibble (d, x + c, m, c, fg, bg, opaque);
+    c++;
+    }
+  uint8_t *p = d + (x + c) / 2;
+  if (c & 1)
+    {
+    for (; c + 1 < c2; c += 2, p++)
+      atlas_blend_byte (p, (m[c / 2] << 4) | (m[c / 2 + 1] >> 4), 
+        fg, bg, opaque);
+    }
+  else
+    {
+    for (; c + 1 < c2; c += 2, p++)
+      atlas_blend_byte (p, m[c / 2], fg, bg, opaque);
+    }
+  if (c < c2)
+    atlas_blend_nibble (d, x + c, m, c, fg, bg, opaque);
+  }
+
+
+void atlas_blit (const Atlas *atlas, const AtlasGlyph *g, uint8_t *buffer,
+      int stride, int x, int y, int cell_w, int cell_h, int cx1, int cy1,
+      int cx2, int cy2, uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  // The visible part of the cell
+  int x1 = x > cx1 ? x : cx1;
+  int y1 = y > cy1 ? y : cy1;
+  int x2 = x + cell_w < cx2 ? x + cell_w : cx2;
+  int y2 = y + cell_h < cy2 ? y + cell_h : cy2;
+  if (x1 >= x2 || y1 >= y2) return;
+
+  // The visible part of the glyph's box
+  int gx = x + g->x;
+  int gy = y + g->y;
+  int gx1 = gx > x1 ? gx : x1;
+  int gy1 = gy > y1 ? gy : y1;
+  int gx2 = gx + g->w < x2 ? gx + g->w : x2;
+  int gy2 = gy + g->h < y2 ? gy + g->h : y2;
+  if (gx1 >= gx2 || gy1 >= gy2)
+    {
+    if (opaque) span_fill_rect (buffer, stride, x1, y1, x2, y2, bg);
+    return;
+    }
+
+  int row_bytes = atlas->format == ATLAS_BITS 
+    ? (g->w + 7) / 8 : (g->w + 1) / 2;
+  const uint8_t *m = atlas->data + g->offset + (gy1 - gy) * row_bytes;
+  if (opaque)
+    {
+    // Every pixel of the cell outside the glyph's box is background
+    span_fill_rect (buffer, stride, x1, y1, x2, gy1, bg);
+    span_fill_rect (buffer, stride, x1, gy2, x2, y2, bg);
+    span_fill_rect (buffer, stride, x1, gy1, gx1, gy2, bg);
+    span_fill_rect (buffer, stride, gx2, gy1, x2, gy2, bg);
+    }
+  if (atlas->format == ATLAS_COVERAGE)
+    {
+    fg &= 0x0F;
+    bg &= 0x0F;
+    span_blend_init ();
+    for (int row = gy1; row < gy2; row++)
+      {
+      atlas_row_coverage (buffer + row * stride, gx, m, gx1 - gx, 
+        gx2 - gx, fg, bg, opaque);
+      m += row_bytes;
+      }
+    }
+  else if (atlas->format == ATLAS_BITS)
+    {
+    // A glyph box is at most 255 pixels wide
+    uint8_t expanded[128];
+    for (int row = gy1; row < gy2; row++)
+      {
+      atlas_expand_row (expanded, m, gx1 - gx, gx2 - gx);
+      atlas_row (buffer + row * stride, gx, expanded, gx1 - gx, gx2 - gx,
+        fg, bg, opaque);
+      m += row_bytes;
+      }
+    }
+  else
+    {
+    for (int row = gy1; row < gy2; row++)
+      {
+      atlas_row (buffer + row * stride, gx, m, gx1 - gx, gx2 - gx,
+        fg, bg, opaque);
+      m += row_bytes;
+      }
+    }
+  }
+
@@ -0,0 +1,251 @@
+/*========================================================================
+  spi-oled
+  compositor.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Compositing layers -- off-screen surfaces -- into the frame buffer.
+  Only the areas that some layer has changed are composited, and each
+  area starts from the topmost layer that hides everything beneath it.
+  Opaque layers are copied, and keyed layers masked, a byte at a time;
+  only translucent layers are blended pixel by pixel
+========================================================================*/
+#include <stdlib.h>
+#include <spi_oled/compositor.h>
+#include <spi_oled/span.h>
+#include <spi_oled/debug.h>
+
+/* Set the area that must be composited regardless of damage to empty */
+static void compositor_clear_exposed (Compositor *self)
+  {
+  self->x1 = self->y1 = 0x7FFFFFFF;
+  self->x2 = self->y2 = 0;
+  }
+
+
+/* Add the screen area covered by a layer to the exposed area */
+static void compositor_expose (Compositor *self, const CompositorLayer *l)
+  {
+  if (l->x < self->x1) self->x1 = l->x;
+  if (l->y < self->y1) self->y1 = l->y;
+  if (l->x + l->surface->width > self->x2)
+    self->x2 = l->x + l->surface->width;
+  if (l->y + l->surface->height > self->y2)
+    self->y2 = l->y + l->surface->height;
+  }
+
+
+Compositor *compositor_new (uint8_t background)
+  {
+  debug_log ("Call compositor_new");
+  Compositor *self = malloc (sizeof (Compositor));
+  self->n_layers = 0;
+  self->background = background & 0x0F;
+  // Nothing has been composited yet, so the whole screen is exposed,
+  //  and the first composite fills what no layer covers with the
+  //  background. compositor_damage() clips this to the screen
+  self->x1 = self->y1 = 0;
+  self->x2 = self->y2 = 0x7FFFFFFF;
+  return self;
+  }
+
+
+void compositor_free (Compositor *self)
+  {
+  if (self)
+    {
+    for (int i = 0; i < self->n_layers; i++)
+      spi_oled_surface_free (self->layers[i].surface);
+    free (self);
+    }
+  else
+    debug_log ("self is null in compositor_free");
+  }
+
+
+CompositorLayer *compositor_add_layer (Compositor *self, int x, int y,
+      int w, int h, int key, uint8_t alpha)
+  {
+  if (self->n_layers == COMPOSITOR_MAX_LAYERS)
+    {
+    debug_log ("Compositor has no room for another layer");
+    return NULL;
+    }
+  CompositorLayer *layer = &self->layers[self->n_layers++];
+  layer->surface = spi_oled_surface_new (w, h);
+  layer->x = x;
+  layer->y = y;
+  layer->key = key;
+  layer->alpha = alpha > 15 ? 15 : alpha;
+  spi_oled_surface_invalidate (layer->surface);
+  return layer;
+  }
+
+
+/* The old position is uncovered; the new one is covered by the whole
+ * of the layer, as if it had all been drawn again */
+void compositor_move_layer (Compositor *self, CompositorLayer *layer,
+      int x, int y)
+  {
+  if (layer->x == x && layer->y == y) return;
+  compositor_expose (self, layer);
+  layer->x = x;
+  layer->y = y;
+  spi_oled_surface_invalidate (layer->surface);
+  }
+
+
+void compositor_set_blend (Compositor *self, CompositorLayer *layer,
+      int key, uint8_t alpha)
+  {
+  if (alpha > 15) alpha = 15;
+  if (layer->key == key && layer->alpha == alpha) return;
+  layer->key = key;
+  layer->alpha = alpha;
+  compositor_expose (self, layer);
+  }
+
+
+/* Lay n pixels of a translucent layer's row src, from pixel sx, over the
+ * row dst from pixel dx */
+static void compositor_blend_row (uint8_t *dst, int dx, const uint8_t *src,
+      int sx, int n, int key, uint8_t alpha)
+  {
+  for (int i = 0; i < n; i++)
+    {
+    uint8_t s = span_get (src, 0, sx + i, 0);
+    if (s == key) continue;
+    uint8_t u = span_get (dst, 0, dx + i, 0);
+    span_pixel (dst, 0, dx + i, 0, span_blend (alpha, s, u));
+    }
+  }
+
+
+/* Does the layer hide everything beneath it in x1,y1 to x2,y2? */
+static BOOL compositor_covers (const CompositorLayer *l, int x1, int y1,
+      int x2, int y2)
+  {
+  return l->key == COMPOSITOR_NO_KEY && l->alpha == 15
+    && l->x <= x1 && l->y <= y1
+    && l->x + l->surface->width >= x2 && l->y + l->surface->height >= y2;
+  }
+
+
+/* Build up the screen area x1,y1 to x2,y2 from the layers */
+static void compositor_area (Compositor *self, SPIOled *oled, int x1,
+      int y1, int x2, int y2)
+  {
+  uint8_t *buffer = oled->screen.buffer;
+  int stride = oled->screen.stride;
+  int bottom = self->n_layers - 1;
+  while (bottom >= 0
+      && !compositor_covers (&self->layers[bottom], x1, y1, x2, y2))
+    bottom--;
+  if (bottom < 0)
+    {
+    span_fill_rect (buffer, stride, x1, y1, x2, y2, self->background);
+    bottom = 0;
+    }
+
+  for (int i = bottom; i < self->n_layers; i++)
+    {
+    const CompositorLayer *l = &self->layers[i];
+    const SPIOledSurface *s = l->surface;
+    int lx1 = l->x > x1 ? l->x : x1;
+    int ly1 = l->y > y1 ? l->y : y1;
+    int lx2 = l->x + s->width < x2 ? l->x + s->width : x2;
+    int ly2 = l->y + s->height < y2 ? l->y + s->height : y2;
+    if (lx1 >= lx2 || ly1 >= ly2 || l->alpha == 0) continue;
+    int w = lx2 - lx1, h = ly2 - ly1;
+    int sx = lx1 - l->x, sy = ly1 - l->y;
+    if (l->alpha == 15)
+      {
+      if (l->key == COMPOSITOR_NO_KEY)
+        span_copy_rect (buffer, stride, lx1, ly1, s->buffer, s->stride,
+          sx, sy, w, h);
+      else
+        span_rop_rect (buffer, stride, lx1, ly1, s->buffer, s->stride,
+          sx, sy, w, h, SPI_OLED_ROP_KEY, l->key);
+      }
+    else
+      {
+      for (int row = 0; row < h; row++)
+        compositor_blend_row (buffer + (ly1 + row) * stride, lx1,
+          s->buffer + (sy + row) * s->stride, sx, w, l->key, l->alpha);
+      }
+    }
+  spi_oled_surface_mark_dirty (&oled->screen, x1, y1, x2, y2);
+  }
+
+
+/* Collect the layers' damage rectangles, and the exposed area, in screen
+ * coordinates. Rectangles that overlap are merged, so that no pixel is
+ * composited twice. Returns the number of rectangles */
+static int compositor_damage (Compositor *self, const SPIOled *oled,
+      int rects[][4])
+  {
+  int n = 0;
+  for (int i = -1; i < self->n_layers; i++)
+    {
+    int *r = rects[n];
+    if (i < 0)
+      {
+      r[0] = self->x1;
+      r[1] = self->y1;
+      r[2] = self->x2;
+      r[3] = self->y2;
+      }
+    else
+      {
+      const CompositorLayer *l = &self->layers[i];
+      const SPIOledSurface *s = l->surface;
+      // The damage rectangle's right edge can be one past an odd width
+      r[0] = l->x + s->dirty_x1;
+      r[1] = l->y + s->dirty_y1;
+      r[2] = l->x + (s->dirty_x2 < s->width ? s->dirty_x2 : s->width);
+      r[3] = l->y + s->dirty_y2;
+      }
+    if (r[0] < 0) r[0] = 0;
+    if (r[1] < 0) r[1] = 0;
+    if (r[2] > oled->width) r[2] = oled->width;
+    if (r[3] > oled->height) r[3] = oled->height;
+    if (r[0] < r[2] && r[1] < r[3]) n++;
+    }
+
+  for (int i = 0; i < n; i++)
+    {
+    for (int j = i + 1; j < n; j++)
+      {
+      int *a = rects[i], *b = rects[j];
+      if (a[0] >= b[2] || b[0] >= a[2] || a[1] >= b[3] || b[1] >= a[3])
+        continue;
+      if (b[0] < a[0]) a[0] = b[0];
+      if (b[1] < a[1]) a[1] = b[1];
+      if (b[2] > a[2]) a[2] = b[2];
+      if (b[3] > a[3]) a[3] = b[3];
+      for (int k = 0; k < 4; k++)
+        b[k] = rects[n - 1][k];
+      n--;
+      // The merged rectangle may now overlap one that it didn't before,
+      //  so start again
+      i = -1;
+      break;
+      }
+    }
+  return n;
+  }
+
+
+void compositor_composite (Compositor *self, SPIOled *oled)
+  {
+  span_blend_init ();
+  int rects[COMPOSITOR_MAX_LAYERS + 1][4];
+  int n = compositor_damage (self, oled, rects);
+  for (int i = 0; i < n; i++)
+    compositor_area (self, oled, rects[i][0], rects[i][1], rects[i][2],
+      rects[i][3]);
+  for (int i = 0; i < self->n_layers; i++)
+    spi_oled_surface_clear_dirty (self->layers[i].surface);
+  compositor_clear_exposed (self);
+  }
+
@@ -0,0 +1,198 @@
+/*========================================================================
+  spi-oled
+  Glyph atlas for Font12, generated by tools/fontc from fonts/font12.c
+  Do not edit -- run 'make atlases' to regenerate
+========================================================================*/
+#include <stddef.h>
+#include <spi_oled/fonts.h>
+#include <spi_oled/atlas.h>
+
+static const uint16_t Font12_Pages[] = 
+  {
+  0,
+  };
+
+static const uint16_t Font12_Index[] = 
+  {
+  // U+0000
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+  18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+  28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+  38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+  58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+  68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+  78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94,
+  };
+
+static const AtlasGlyph Font12_Glyphs[] = 
+  {
+  {     0,  0,  0,  0,  0 }, // U+0020
+  {     0,  3,  1,  1,  8 }, // U+0021 '!'
+  {     8,  1,  1,  5,  3 }, // U+0022 '"'
+  {    11,  1,  1,  5,  9 }, // U+0023 '#'
+  {    20,  1,  1,  4,  9 }, // U+0024 '$'
+  {    29,  1,  1,  5,  8 }, // U+0025 '%'
+  {    37,  1,  3,  5,  6 }, // U+0026 '&'
+  {    43,  3,  1,  1,  4 }, // U+0027 '''
+  {    47,  3,  1,  2, 10 }, // U+0028 '('
+  {    57,  2,  1,  2, 10 }, // U+0029 ')'
+  {    67,  1,  1,  5,  5 }, // U+002A '*'
+  {    72,  0,  2,  7,  7 }, // U+002B '+'
+  {    79,  2,  7,  3,  4 }, // U+002C ','
+  {    83,  1,  5,  5,  1 }, // U+002D '-'
+  {    84,  2,  7,  2,  2 }, // U+002E '.'
+  {    86,  1,  1,  5,  9 }, // U+002F '/'
+  {    95,  1,  1,  5,  8 }, // U+0030 '0'
+  {   103,  1,  1,  5,  8 }, // U+0031 '1'
+  {   111,  1,  1,  5,  8 }, // U+0032 '2'
+  {   119,  1,  1,  5,  8 }, // U+0033 '3'
+  {   127,  1,  1,  6,  8 }, // U+0034 '4'
+  {   135,  1,  1,  5,  8 }, // U+0035 '5'
+  {   143,  1,  1,  5,  8 }, // U+0036 '6'
+  {   151,  1,  1,  5,  8 }, // U+0037 '7'
+  {   159,  1,  1,  5,  8 }, // U+0038 '8'
+  {   167,  1,  1,  5,  8 }, // U+0039 '9'
+  {   175,  2,  3,  2,  6 }, // U+003A ':'
+  {   181,  2,  3,  3,  7 }, // U+003B ';'
+  {   188,  0,  2,  6,  7 }, // U+003C '<'
+  {   195,  1,  4,  5,  3 }, // U+003D '='
+  {   198,  0,  2,  6,  7 }, // U+003E '>'
+  {   205,  2,  2,  4,  7 }, // U+003F '?'
+  {   212,  1,  0,  5, 10 }, // U+0040 '@'
+  {   222,  0,  1,  7,  8 }, // U+0041 'A'
+  {   230,  0,  1,  6,  8 }, // U+0042 'B'
+  {   238,  1,  1,  5,  8 }, // U+0043 'C'
+  {   246,  0,  1,  6,  8 }, // U+0044 'D'
+  {   254,  0,  1,  6,  8 }, // U+0045 'E'
+  {   262,  1,  1,  6,  8 }, // U+0046 'F'
+  {   270,  1,  1,  6,  8 }, // U+0047 'G'
+  {   278,  0,  1,  7,  8 }, // U+0048 'H'
+  {   286,  1,  1,  5,  8 }, // U+0049 'I'
+  {   294,  1,  1,  5,  8 }, // U+004A 'J'
+  {   302,  0,  1,  7,  8 }, // U+004B 'K'
+  {   310,  1,  1,  5,  8 }, // U+004C 'L'
+  {   318,  0,  1,  7,  8 }, // U+004D 'M'
+  {   326,  0,  1,  7,  8 }, // U+004E 'N'
+  {   334,  1,  1,  5,  8 }, // U+004F 'O'
+  {   342,  1,  1,  5,  8 }, // U+0050 'P'
+  {   350,  1,  1,  5,  9 }, // U+0051 'Q'
+  {   359,  0,  1,  7,  8 }, // U+0052 'R'
+  {   367,  1,  1,  5,  8 }, // U+0053 'S'
+  {   375,  0,  1,  7,  8 }, // U+0054 'T'
+  {   383,  0,  1,  7,  8 }, // U+0055 'U'
+  {   391,  0,  1,  7,  8 }, // U+0056 'V'
+  {   399,  0,  1,  7,  8 }, // U+0057 'W'
+  {   407,  0,  1,  7,  8 }, // U+0058 'X'
+  {   415,  0,  1,  7,  8 }, // U+0059 'Y'
+  {   423,  1,  1,  5,  8 }, // U+005A 'Z'
+  {   431,  2,  1,  3, 10 }, // U+005B '['
+  {   441,  1,  1,  4,  9 }, // U+005C
+  {   450,  2,  1,  3, 10 }, // U+005D ']'
+  {   460,  1,  1,  5,  4 }, // U+005E '^'
+  {   464,  0, 11,  7,  1 }, // U+005F '_'
+  {   465,  3,  1,  2,  2 }, // U+0060 '`'
+  {   467,  1,  3,  6,  6 }, // U+0061 'a'
+  {   473,  0,  1,  6,  8 }, // U+0062 'b'
+  {   481,  1,  3,  5,  6 }, // U+0063 'c'
+  {   487,  1,  1,  6,  8 }, // U+0064 'd'
+  {   495,  1,  3,  5,  6 }, // U+0065 'e'
+  {   501,  1,  1,  5,  8 }, // U+0066 'f'
+  {   509,  1,  3,  6,  8 }, // U+0067 'g'
+  {   517,  0,  1,  7,  8 }, // U+0068 'h'
+  {   525,  1,  1,  5,  8 }, // U+0069 'i'
+  {   533,  1,  1,  4, 10 }, // U+006A 'j'
+  {   543,  0,  1,  6,  8 }, // U+006B 'k'
+  {   551,  1,  1,  5,  8 }, // U+006C 'l'
+  {   559,  0,  3,  7,  6 }, // U+006D 'm'
+  {   565,  0,  3,  7,  6 }, // U+006E 'n'
+  {   571,  1,  3,  5,  6 }, // U+006F 'o'
+  {   577,  0,  3,  6,  8 }, // U+0070 'p'
+  {   585,  1,  3,  6,  8 }, // U+0071 'q'
+  {   593,  1,  3,  5,  6 }, // U+0072 'r'
+  {   599,  1,  3,  5,  6 }, // U+0073 's'
+  {   605,  1,  2,  6,  7 }, // U+0074 't'
+  {   612,  0,  3,  7,  6 }, // U+0075 'u'
+  {   618,  0,  3,  7,  6 }, // U+0076 'v'
+  {   624,  0,  3,  7,  6 }, // U+0077 'w'
+  {   630,  0,  3,  6,  6 }, // U+0078 'x'
+  {   636,  0,  3,  7,  8 }, // U+0079 'y'
+  {   644,  1,  3,  5,  6 }, // U+007A 'z'
+  {   650,  2,  1,  3, 10 }, // U+007B '{'
+  {   660,  3,  1,  1,  9 }, // U+007C '|'
+  {   669,  2,  1,  3, 10 }, // U+007D '}'
+  {   679,  1,  5,  5,  2 }, // U+007E '~'
+  };
+
+static const uint8_t Font12_Data[] = 
+  {
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x80, 0xd8, 0x90, 0x90, 0x28,
+  0x28, 0x50, 0xf8, 0x50, 0xf8, 0x50, 0xa0, 0xa0, 0x20, 0x70, 0x80, 0x80,
+  0x70, 0x90, 0xe0, 0x20, 0x20, 0x40, 0xa0, 0x40, 0x18, 0xe0, 0x10, 0x28,
+  0x10, 0x30, 0x40, 0x40, 0xa8, 0x90, 0x68, 0x80, 0x80, 0x80, 0x80, 0x40,
+  0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x80, 0x80, 0x40,
+  0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x80, 0x20, 0xf8, 0x20, 0x50, 0x50,
+  0x10, 0x10, 0x10, 0xfe, 0x10, 0x10, 0x10, 0x60, 0x40, 0xc0, 0x80, 0xf8,
+  0xc0, 0xc0, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x70,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x60, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0xf8, 0x70, 0x88, 0x08, 0x10, 0x20, 0x40, 0x88, 0xf8, 0x70,
+  0x88, 0x08, 0x30, 0x08, 0x08, 0x88, 0x70, 0x18, 0x28, 0x28, 0x48, 0x88,
+  0xfc, 0x08, 0x1c, 0x78, 0x40, 0x40, 0x70, 0x08, 0x08, 0x88, 0x70, 0x38,
+  0x40, 0x80, 0xf0, 0x88, 0x88, 0x88, 0x70, 0xf8, 0x88, 0x08, 0x10, 0x10,
+  0x10, 0x20, 0x20, 0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x88, 0x70, 0x70,
+  0x88, 0x88, 0x88, 0x78, 0x08, 0x10, 0xe0, 0xc0, 0xc0, 0x00, 0x00, 0xc0,
+  0xc0, 0x60, 0x60, 0x00, 0x00, 0x60, 0xc0, 0x80, 0x0c, 0x10, 0x60, 0x80,
+  0x60, 0x10, 0x0c, 0xf8, 0x00, 0xf8, 0xc0, 0x20, 0x18, 0x04, 0x18, 0x20,
+  0xc0, 0x60, 0x90, 0x10, 0x20, 0x40, 0x00, 0xc0, 0x70, 0x88, 0x88, 0x98,
+  0xa8, 0xa8, 0x98, 0x80, 0x88, 0x70, 0x30, 0x10, 0x28, 0x28, 0x28, 0x7c,
+  0x44, 0xee, 0xf8, 0x44, 0x44, 0x78, 0x44, 0x44, 0x44, 0xf8, 0x78, 0x88,
+  0x80, 0x80, 0x80, 0x80, 0x88, 0x70, 0xf0, 0x48, 0x44, 0x44, 0x44, 0x44,
+  0x48, 0xf0, 0xfc, 0x44, 0x50, 0x70, 0x50, 0x40, 0x44, 0xfc, 0xfc, 0x44,
+  0x50, 0x70, 0x50, 0x40, 0x40, 0xe0, 0x78, 0x88, 0x80, 0x80, 0x9c, 0x88,
+  0x88, 0x70, 0xee, 0x44, 0x44, 0x7c, 0x44, 0x44, 0x44, 0xee, 0xf8, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0xf8, 0x78, 0x10, 0x10, 0x10, 0x90, 0x90,
+  0x90, 0x60, 0xee, 0x44, 0x48, 0x50, 0x70, 0x48, 0x44, 0xe6, 0xe0, 0x40,
+  0x40, 0x40, 0x40, 0x48, 0x48, 0xf8, 0xee, 0x6c, 0x6c, 0x54, 0x54, 0x44,
+  0x44, 0xee, 0xee, 0x64, 0x64, 0x54, 0x54, 0x54, 0x4c, 0xec, 0x70, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0xf0, 0x48, 0x48, 0x48, 0x70, 0x40,
+  0x40, 0xe0, 0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x38, 0xf8,
+  0x44, 0x44, 0x44, 0x78, 0x48, 0x44, 0xe2, 0x68, 0x98, 0x80, 0x70, 0x08,
+  0x08, 0xc8, 0xb0, 0xfe, 0x92, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0xee,
+  0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0xee, 0x44, 0x44, 0x28, 0x28,
+  0x28, 0x10, 0x10, 0xee, 0x44, 0x44, 0x54, 0x54, 0x54, 0x54, 0x28, 0xc6,
+  0x44, 0x28, 0x10, 0x10, 0x28, 0x44, 0xc6, 0xee, 0x44, 0x28, 0x28, 0x10,
+  0x10, 0x10, 0x38, 0xf8, 0x88, 0x10, 0x20, 0x20, 0x40, 0x88, 0xf8, 0xe0,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xe0, 0x80, 0x40, 0x40,
+  0x40, 0x20, 0x20, 0x10, 0x10, 0x10, 0xe0, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0xe0, 0x20, 0x20, 0x50, 0x88, 0xfe, 0x80, 0x40, 0x70,
+  0x88, 0x78, 0x88, 0x88, 0x7c, 0xc0, 0x40, 0x58, 0x64, 0x44, 0x44, 0x44,
+  0xf8, 0x78, 0x88, 0x80, 0x80, 0x88, 0x70, 0x18, 0x08, 0x68, 0x98, 0x88,
+  0x88, 0x88, 0x7c, 0x70, 0x88, 0xf8, 0x80, 0x80, 0x78, 0x38, 0x40, 0xf8,
+  0x40, 0x40, 0x40, 0x40, 0xf8, 0x6c, 0x98, 0x88, 0x88, 0x88, 0x78, 0x08,
+  0x70, 0xc0, 0x40, 0x58, 0x64, 0x44, 0x44, 0x44, 0xee, 0x20, 0x00, 0xe0,
+  0x20, 0x20, 0x20, 0x20, 0xf8, 0x20, 0x00, 0xf0, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0xe0, 0xc0, 0x40, 0x5c, 0x48, 0x70, 0x50, 0x48, 0xdc, 0x60,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0xf8, 0xe8, 0x54, 0x54, 0x54, 0x54,
+  0xfe, 0xd8, 0x64, 0x44, 0x44, 0x44, 0xee, 0x70, 0x88, 0x88, 0x88, 0x88,
+  0x70, 0xd8, 0x64, 0x44, 0x44, 0x44, 0x78, 0x40, 0xe0, 0x6c, 0x98, 0x88,
+  0x88, 0x88, 0x78, 0x08, 0x1c, 0xd8, 0x60, 0x40, 0x40, 0x40, 0xf8, 0x78,
+  0x88, 0x70, 0x08, 0x88, 0xf0, 0x40, 0xf8, 0x40, 0x40, 0x40, 0x44, 0x38,
+  0xcc, 0x44, 0x44, 0x44, 0x4c, 0x36, 0xee, 0x44, 0x44, 0x28, 0x28, 0x10,
+  0xee, 0x44, 0x54, 0x54, 0x54, 0x28, 0xcc, 0x48, 0x30, 0x30, 0x48, 0xcc,
+  0xee, 0x44, 0x24, 0x28, 0x18, 0x10, 0x10, 0x78, 0xf8, 0x90, 0x20, 0x40,
+  0x88, 0xf8, 0x20, 0x40, 0x40, 0x40, 0x40, 0x80, 0x40, 0x40, 0x40, 0x20,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40,
+  0x40, 0x40, 0x20, 0x40, 0x40, 0x40, 0x80, 0x48, 0xb0,
+  };
+
+const Atlas Font12_Atlas = 
+  {
+  127, Font12_Pages, Font12_Index, Font12_Glyphs, Font12_Data, ATLAS_BITS
+  };
+
+sFONT Font12 = { NULL, 7, 12, &Font12_Atlas };
@@ -0,0 +1,322 @@
+/*========================================================================
+  spi-oled
+  Glyph atlas for Font12AA, generated by tools/fontc from fonts/font24.c
+  Do not edit -- run 'make atlases' to regenerate
+========================================================================*/
+#include <stddef.h>
+#include <spi_oled/fonts.h>
+#include <spi_oled/atlas.h>
+
+static const uint16_t Font12AA_Pages[] = 
+  {
+  0,
+  };
+
+static const uint16_t Font12AA_Index[] = 
+  {
+  // U+0000
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+  18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+  28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+  38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+  58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+  68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+  78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94,
+  };
+
+static const AtlasGlyph Font12AA_Glyphs[] = 
+  {
+  {     0,  0,  0,  0,  0 }, // U+0020
+  {     0,  3,  1,  2,  8 }, // U+0021 '!'
+  {     8,  2,  1,  4,  4 }, // U+0022 '"'
+  {    16,  1,  1,  6,  8 }, // U+0023 '#'
+  {    40,  1,  0,  5, 10 }, // U+0024 '$'
+  {    70,  1,  1,  6,  8 }, // U+0025 '%'
+  {    94,  1,  2,  6,  7 }, // U+0026 '&'
+  {   115,  3,  1,  2,  4 }, // U+0027 '''
+  {   119,  3,  1,  4,  9 }, // U+0028 '('
+  {   137,  1,  1,  4,  9 }, // U+0029 ')'
+  {   155,  1,  1,  6,  5 }, // U+002A '*'
+  {   170,  1,  2,  6,  6 }, // U+002B '+'
+  {   188,  3,  7,  3,  4 }, // U+002C ','
+  {   196,  1,  4,  6,  2 }, // U+002D '-'
+  {   202,  3,  7,  2,  2 }, // U+002E '.'
+  {   204,  1,  0,  6, 10 }, // U+002F '/'
+  {   234,  1,  1,  6,  8 }, // U+0030 '0'
+  {   258,  1,  1,  6,  8 }, // U+0031 '1'
+  {   282,  1,  1,  6,  8 }, // U+0032 '2'
+  {   306,  1,  1,  6,  8 }, // U+0033 '3'
+  {   330,  1,  1,  6,  8 }, // U+0034 '4'
+  {   354,  1,  1,  6,  8 }, // U+0035 '5'
+  {   378,  1,  1,  6,  8 }, // U+0036 '6'
+  {   402,  1,  1,  6,  8 }, // U+0037 '7'
+  {   426,  1,  1,  6,  8 }, // U+0038 '8'
+  {   450,  1,  1,  6,  8 }, // U+0039 '9'
+  {   474,  3,  3,  2,  6 }, // U+003A ':'
+  {   480,  3,  3,  3,  7 }, // U+003B ';'
+  {   494,  0,  2,  7,  7 }, // U+003C '<'
+  {   522,  0,  3,  7,  4 }, // U+003D '='
+  {   538,  0,  2,  8,  7 }, // U+003E '>'
+  {   566,  1,  1,  5,  8 }, // U+003F '?'
+  {   590,  1,  1,  6,  9 }, // U+0040 '@'
+  {   617,  0,  1,  8,  8 }, // U+0041 'A'
+  {   649,  0,  1,  7,  8 }, // U+0042 'B'
+  {   681,  1,  1,  6,  8 }, // U+0043 'C'
+  {   705,  0,  1,  7,  8 }, // U+0044 'D'
+  {   737,  0,  1,  7,  8 }, // U+0045 'E'
+  {   769,  1,  1,  6,  8 }, // U+0046 'F'
+  {   793,  1,  1,  7,  8 }, // U+0047 'G'
+  {   825,  0,  1,  8,  8 }, // U+0048 'H'
+  {   857,  1,  1,  6,  8 }, // U+0049 'I'
+  {   881,  1,  1,  7,  8 }, // U+004A 'J'
+  {   913,  0,  1,  8,  8 }, // U+004B 'K'
+  {   945,  0,  1,  7,  8 }, // U+004C 'L'
+  {   977,  0,  1,  8,  8 }, // U+004D 'M'
+  {  1009,  0,  1,  8,  8 }, // U+004E 'N'
+  {  1041,  1,  1,  6,  8 }, // U+004F 'O'
+  {  1065,  1,  1,  6,  8 }, // U+0050 'P'
+  {  1089,  1,  1,  6,  9 }, // U+0051 'Q'
+  {  1116,  0,  1,  8,  8 }, // U+0052 'R'
+  {  1148,  1,  1,  6,  8 }, // U+0053 'S'
+  {  1172,  1,  1,  6,  8 }, // U+0054 'T'
+  {  1196,  0,  1,  8,  8 }, // U+0055 'U'
+  {  1228,  0,  1,  8,  8 }, // U+0056 'V'
+  {  1260,  0,  1,  9,  8 }, // U+0057 'W'
+  {  1300,  0,  1,  8,  8 }, // U+0058 'X'
+  {  1332,  0,  1,  8,  8 }, // U+0059 'Y'
+  {  1364,  1,  1,  6,  8 }, // U+005A 'Z'
+  {  1388,  3,  1,  3,  9 }, // U+005B '['
+  {  1406,  1,  0,  6, 10 }, // U+005C
+  {  1436,  2,  1,  3,  9 }, // U+005D ']'
+  {  1454,  1,  0,  6,  5 }, // U+005E '^'
+  {  1469,  0, 11,  8,  1 }, // U+005F '_'
+  {  1473,  3,  0,  3,  3 }, // U+0060 '`'
+  {  1479,  1,  3,  6,  6 }, // U+0061 'a'
+  {  1497,  0,  1,  7,  8 }, // U+0062 'b'
+  {  1529,  1,  3,  6,  6 }, // U+0063 'c'
+  {  1547,  1,  1,  7,  8 }, // U+0064 'd'
+  {  1579,  1,  3,  6,  6 }, // U+0065 'e'
+  {  1597,  1,  1,  6,  8 }, // U+0066 'f'
+  {  1621,  1,  3,  7,  8 }, // U+0067 'g'
+  {  1653,  0,  1,  8,  8 }, // U+0068 'h'
+  {  1685,  1,  1,  6,  8 }, // U+0069 'i'
+  {  1709,  1,  1,  5, 10 }, // U+006A 'j'
+  {  1739,  1,  1,  6,  8 }, // U+006B 'k'
+  {  1763,  1,  1,  6,  8 }, // U+006C 'l'
+  {  1787,  0,  3,  8,  6 }, // U+006D 'm'
+  {  1811,  0,  3,  8,  6 }, // U+006E 'n'
+  {  1835,  1,  3,  6,  6 }, // U+006F 'o'
+  {  1853,  0,  3,  7,  8 }, // U+0070 'p'
+  {  1885,  1,  3,  7,  8 }, // U+0071 'q'
+  {  1917,  1,  3,  6,  6 }, // U+0072 'r'
+  {  1935,  1,  3,  6,  6 }, // U+0073 's'
+  {  1953,  1,  1,  6,  8 }, // U+0074 't'
+  {  1977,  0,  3,  8,  6 }, // U+0075 'u'
+  {  2001,  0,  3,  8,  6 }, // U+0076 'v'
+  {  2025,  0,  3,  7,  6 }, // U+0077 'w'
+  {  2049,  1,  3,  6,  6 }, // U+0078 'x'
+  {  2067,  0,  3,  8,  8 }, // U+0079 'y'
+  {  2099,  1,  3,  6,  6 }, // U+007A 'z'
+  {  2117,  2,  1,  4,  9 }, // U+007B '{'
+  {  2135,  3,  1,  2,  9 }, // U+007C '|'
+  {  2144,  2,  1,  4,  9 }, // U+007D '}'
+  {  2162,  1,  4,  6,  3 }, // U+007E '~'
+  };
+
+static const uint8_t Font12AA_Data[] = 
+  {
+  0xf8, 0xf8, 0xf8, 0xf8, 0xb4, 0x40, 0x84, 0x84, 0x84, 0x48, 0xf8, 0x8f,
+  0x80, 0x08, 0x80, 0x08, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x8b, 0xbb,
+  0xb4, 0x8b, 0xbb, 0xb4, 0x8f, 0x8f, 0x84, 0x8f, 0x8f, 0x84, 0x0f, 0x0f,
+  0x00, 0x0f, 0x0f, 0x00, 0x00, 0x44, 0x00, 0x04, 0xb8, 0x80, 0x4b, 0x8b,
+  0xf0, 0x8b, 0x04, 0x80, 0x0b, 0xfb, 0x40, 0x44, 0x08, 0xf0, 0x8f, 0x04,
+  0xf0, 0x8b, 0xff, 0x40, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x0b, 0xfb,
+  0x00, 0x8b, 0x0b, 0x80, 0x8b, 0x0b, 0x80, 0x0b, 0xff, 0xb4, 0x4b, 0xf8,
+  0xf4, 0x08, 0x80, 0x88, 0x04, 0xf8, 0xf4, 0x00, 0x48, 0x40, 0x04, 0xff,
+  0xf0, 0x0f, 0x04, 0x40, 0x0b, 0x40, 0x00, 0x0b, 0xf4, 0x48, 0x8b, 0x4f,
+  0xf8, 0x4b, 0x8b, 0xf8, 0x04, 0x88, 0x48, 0x84, 0xf8, 0x80, 0x80, 0x00,
+  0xb8, 0x0b, 0xf0, 0x0f, 0x80, 0x8f, 0x00, 0x8f, 0x00, 0x8f, 0x00, 0x0f,
+  0x80, 0x08, 0xf0, 0x00, 0xb8, 0x8b, 0x00, 0x0f, 0x80, 0x08, 0xf0, 0x00,
+  0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x08, 0xf0, 0x0f, 0xb0, 0x8b, 0x00, 0x00,
+  0x88, 0x00, 0x48, 0x88, 0x84, 0x4b, 0xff, 0xb4, 0x00, 0xff, 0x00, 0x08,
+  0x88, 0x80, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x88, 0xbb, 0x88, 0x88,
+  0xbb, 0x88, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x0f, 0x40, 0x8b, 0x00,
+  0xb4, 0x00, 0x80, 0x00, 0x48, 0x88, 0x84, 0x48, 0x88, 0x84, 0xff, 0x88,
+  0x00, 0x00, 0x88, 0x00, 0x00, 0xf4, 0x00, 0x08, 0xb0, 0x00, 0x0b, 0x40,
+  0x00, 0x4b, 0x00, 0x00, 0xb4, 0x00, 0x04, 0xb0, 0x00, 0x0b, 0x80, 0x00,
+  0x4f, 0x00, 0x00, 0x88, 0x00, 0x00, 0x04, 0xff, 0x40, 0x0f, 0x00, 0xf0,
+  0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x88, 0x00, 0x88, 0x4b, 0x00, 0xb4,
+  0x0b, 0x88, 0xb0, 0x00, 0x88, 0x00, 0x04, 0x88, 0x00, 0x8f, 0xb8, 0x00,
+  0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00,
+  0x48, 0xbb, 0x84, 0x48, 0x88, 0x84, 0x4b, 0xff, 0x80, 0xf4, 0x00, 0xb4,
+  0x80, 0x00, 0x88, 0x00, 0x04, 0xb0, 0x00, 0xbb, 0x00, 0x0b, 0x40, 0x00,
+  0xbb, 0x88, 0x84, 0x88, 0x88, 0x84, 0x08, 0xff, 0x40, 0x08, 0x04, 0xf0,
+  0x00, 0x04, 0xb0, 0x00, 0xff, 0x40, 0x00, 0x04, 0xb4, 0x00, 0x00, 0x88,
+  0x8b, 0x88, 0xf4, 0x08, 0x88, 0x00, 0x00, 0x4f, 0x80, 0x00, 0xbb, 0x80,
+  0x08, 0x88, 0x80, 0x0f, 0x08, 0x80, 0xb4, 0x08, 0x80, 0xff, 0xff, 0xf8,
+  0x00, 0x8b, 0xb4, 0x00, 0x88, 0x84, 0x8f, 0xff, 0xf0, 0x88, 0x00, 0x00,
+  0x88, 0x88, 0x00, 0x8f, 0x88, 0xf0, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88,
+  0xf8, 0x88, 0xf0, 0x08, 0x88, 0x00, 0x00, 0x8f, 0xf8, 0x0b, 0xb0, 0x00,
+  0x4b, 0x00, 0x00, 0x8b, 0xff, 0x80, 0x8b, 0x00, 0xb4, 0x88, 0x00, 0x88,
+  0x0f, 0x88, 0xf4, 0x00, 0x88, 0x40, 0x8f, 0xff, 0xf8, 0x88, 0x00, 0xb8,
+  0x00, 0x00, 0xf0, 0x00, 0x08, 0xb0, 0x00, 0x0b, 0x80, 0x00, 0x0f, 0x00,
+  0x00, 0x8b, 0x00, 0x00, 0x44, 0x00, 0x0b, 0xff, 0xb0, 0x8b, 0x00, 0xb8,
+  0x4b, 0x00, 0xb4, 0x08, 0xff, 0x80, 0x4b, 0x00, 0xb4, 0x88, 0x00, 0x88,
+  0x4f, 0x88, 0xf4, 0x04, 0x88, 0x40, 0x0b, 0xff, 0x80, 0x8b, 0x00, 0xb4,
+  0x88, 0x00, 0x88, 0x0f, 0x88, 0xf8, 0x00, 0x88, 0x88, 0x00, 0x04, 0xf0,
+  0x48, 0x8f, 0x40, 0x48, 0x80, 0x00, 0xff, 0x88, 0x00, 0x00, 0xff, 0x88,
+  0x0f, 0xf0, 0x08, 0x80, 0x00, 0x00, 0x08, 0x40, 0x8b, 0x00, 0xb4, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x0b, 0xf0, 0x00, 0x08, 0xf8, 0x00, 0x08, 0xf8,
+  0x00, 0x00, 0x8f, 0x80, 0x00, 0x00, 0x00, 0x8f, 0x80, 0x00, 0x00, 0x00,
+  0x8f, 0x80, 0x00, 0x00, 0x04, 0x80, 0x48, 0x88, 0x88, 0x80, 0x48, 0x88,
+  0x88, 0x80, 0x48, 0x88, 0x88, 0x80, 0x48, 0x88, 0x88, 0x80, 0x8f, 0x40,
+  0x00, 0x00, 0x04, 0xbb, 0x40, 0x00, 0x00, 0x04, 0xbb, 0x40, 0x00, 0x00,
+  0x4b, 0xb4, 0x00, 0x4b, 0xb4, 0x00, 0x4b, 0xb4, 0x00, 0x00, 0x48, 0x00,
+  0x00, 0x00, 0x04, 0x88, 0x00, 0x4b, 0x8b, 0xb0, 0x88, 0x00, 0xf0, 0x00,
+  0x0b, 0xb0, 0x00, 0xfb, 0x00, 0x00, 0x80, 0x00, 0x04, 0x80, 0x00, 0x04,
+  0x80, 0x00, 0x04, 0xff, 0xb0, 0x0f, 0x40, 0xb8, 0x88, 0x0b, 0xf8, 0x88,
+  0x8b, 0x88, 0x88, 0x88, 0x88, 0x88, 0x0b, 0xf8, 0x4b, 0x00, 0x00, 0x0b,
+  0xb8, 0xb8, 0x00, 0x88, 0x40, 0x04, 0x88, 0x40, 0x00, 0x04, 0x8b, 0xf0,
+  0x00, 0x00, 0x0f, 0x88, 0x00, 0x00, 0x88, 0x0f, 0x00, 0x00, 0xf8, 0x8f,
+  0x40, 0x08, 0xb8, 0x88, 0xb0, 0x8f, 0x80, 0x48, 0xf8, 0x88, 0x80, 0x48,
+  0x88, 0x48, 0x88, 0x84, 0x00, 0x4b, 0xb8, 0x8f, 0x40, 0x08, 0x80, 0x08,
+  0x80, 0x08, 0xb8, 0x8f, 0x40, 0x08, 0xb8, 0x8b, 0xb0, 0x08, 0x80, 0x00,
+  0xf0, 0x4b, 0xb8, 0x88, 0xb0, 0x48, 0x88, 0x88, 0x00, 0x00, 0x88, 0x48,
+  0x4f, 0x88, 0xbf, 0xb4, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00,
+  0xb4, 0x00, 0x08, 0x4f, 0x88, 0xbb, 0x00, 0x88, 0x80, 0x48, 0x88, 0x80,
+  0x00, 0x4b, 0xb8, 0x8f, 0x40, 0x08, 0x80, 0x04, 0xb0, 0x08, 0x80, 0x00,
+  0xf0, 0x08, 0x80, 0x00, 0xf0, 0x08, 0x80, 0x04, 0xb0, 0x4b, 0xb8, 0x8f,
+  0x40, 0x48, 0x88, 0x84, 0x00, 0x48, 0x88, 0x88, 0x40, 0x4b, 0xb8, 0x8b,
+  0x80, 0x08, 0x84, 0x48, 0x80, 0x08, 0xbb, 0x80, 0x00, 0x08, 0xbb, 0x80,
+  0x00, 0x08, 0x84, 0x48, 0x80, 0x4b, 0xb8, 0x8b, 0x80, 0x48, 0x88, 0x88,
+  0x40, 0x88, 0x88, 0x88, 0x8f, 0x88, 0x8f, 0x0f, 0x08, 0x0f, 0x0f, 0x8f,
+  0x00, 0x0f, 0x8f, 0x00, 0x0f, 0x08, 0x00, 0x8f, 0x88, 0x00, 0x88, 0x88,
+  0x00, 0x00, 0x88, 0x48, 0x00, 0x4f, 0x88, 0xbf, 0x00, 0xb4, 0x00, 0x0f,
+  0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x0f, 0xff, 0x80, 0xf4, 0x00, 0x0f,
+  0x00, 0x4f, 0x88, 0xbf, 0x00, 0x00, 0x88, 0x80, 0x00, 0x48, 0x84, 0x48,
+  0x84, 0x4b, 0xb4, 0x4b, 0xb4, 0x08, 0x80, 0x08, 0x80, 0x08, 0xb8, 0x8b,
+  0x80, 0x08, 0xb8, 0x8b, 0x80, 0x08, 0x80, 0x08, 0x80, 0x4b, 0xb4, 0x4b,
+  0xb4, 0x48, 0x84, 0x48, 0x84, 0x48, 0x88, 0x84, 0x48, 0xbb, 0x84, 0x00,
+  0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x48,
+  0xbb, 0x84, 0x48, 0x88, 0x84, 0x04, 0x88, 0x88, 0x40, 0x04, 0x88, 0xf8,
+  0x40, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf0,
+  0x00, 0xf0, 0x00, 0xf0, 0x00, 0xf8, 0x8b, 0x80, 0x00, 0x08, 0x84, 0x00,
+  0x00, 0x48, 0x88, 0x08, 0x84, 0x4b, 0xb8, 0x0f, 0x84, 0x08, 0x80, 0xb4,
+  0x00, 0x08, 0x8b, 0x80, 0x00, 0x08, 0xf8, 0xf4, 0x00, 0x08, 0x80, 0x4f,
+  0x00, 0x4b, 0xb8, 0x0b, 0xb8, 0x48, 0x88, 0x04, 0x88, 0x48, 0x88, 0x40,
+  0x00, 0x48, 0xf8, 0x40, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x00, 0xf0, 0x00, 0x80, 0x00, 0xf0, 0x00, 0xf0, 0x48, 0xf8, 0x88,
+  0xf0, 0x48, 0x88, 0x88, 0x80, 0x88, 0x00, 0x00, 0x88, 0x8f, 0x80, 0x08,
+  0xf8, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0x88, 0x88, 0xf0, 0x0f, 0x0f, 0xf0,
+  0xf0, 0x0f, 0x04, 0x40, 0xf0, 0x8f, 0x84, 0x48, 0xf8, 0x88, 0x84, 0x48,
+  0x88, 0x48, 0x40, 0x88, 0x84, 0x4b, 0xb0, 0x8b, 0xb4, 0x08, 0xfb, 0x08,
+  0x80, 0x08, 0x8f, 0x48, 0x80, 0x08, 0x84, 0xf8, 0x80, 0x08, 0x80, 0xbf,
+  0x80, 0x4b, 0xb8, 0x0b, 0x80, 0x48, 0x88, 0x04, 0x40, 0x00, 0x88, 0x00,
+  0x4f, 0x88, 0xf4, 0xb8, 0x00, 0x8b, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f,
+  0xb8, 0x00, 0x8b, 0x4f, 0x88, 0xf4, 0x00, 0x88, 0x00, 0x88, 0x88, 0x80,
+  0x8f, 0x88, 0xbb, 0x0f, 0x00, 0x0f, 0x0f, 0x00, 0x4b, 0x0f, 0xff, 0xb4,
+  0x0f, 0x00, 0x00, 0x8f, 0x88, 0x00, 0x88, 0x88, 0x00, 0x00, 0x88, 0x00,
+  0x4f, 0x88, 0xf4, 0xb8, 0x00, 0x8b, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0x0f,
+  0xb8, 0x00, 0x8b, 0x4f, 0x88, 0xf4, 0x08, 0xff, 0x08, 0x0f, 0x88, 0xfb,
+  0x48, 0x88, 0x84, 0x00, 0x4b, 0xb8, 0x8f, 0x40, 0x08, 0x80, 0x08, 0x80,
+  0x08, 0xb8, 0x8f, 0x40, 0x08, 0xb8, 0xf4, 0x00, 0x08, 0x80, 0x4f, 0x00,
+  0x4b, 0xb8, 0x0b, 0xb4, 0x48, 0x88, 0x00, 0x84, 0x04, 0x88, 0x44, 0x4f,
+  0x88, 0xf8, 0x88, 0x00, 0x88, 0x4f, 0xb8, 0x00, 0x00, 0x8b, 0xf4, 0x88,
+  0x00, 0x88, 0x8f, 0x88, 0xf4, 0x44, 0x88, 0x40, 0x88, 0x88, 0x88, 0xf8,
+  0xbb, 0x8f, 0xf0, 0x88, 0x0f, 0x80, 0x88, 0x08, 0x00, 0x88, 0x00, 0x00,
+  0x88, 0x00, 0x08, 0xbb, 0x80, 0x08, 0x88, 0x80, 0x48, 0x84, 0x48, 0x84,
+  0x4b, 0xb4, 0x4b, 0xb4, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80,
+  0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x00, 0xf8, 0x8f, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x48, 0x88, 0x48, 0x88, 0x4b, 0xb8, 0x48, 0xf8,
+  0x00, 0xf0, 0x08, 0x80, 0x00, 0xb4, 0x0b, 0x40, 0x00, 0x4b, 0x4b, 0x00,
+  0x00, 0x0f, 0x88, 0x00, 0x00, 0x08, 0xf0, 0x00, 0x00, 0x00, 0x40, 0x00,
+  0x88, 0x84, 0x08, 0x88, 0x40, 0x8f, 0x84, 0x08, 0xbb, 0x40, 0x0f, 0x00,
+  0x40, 0x88, 0x00, 0x08, 0x88, 0xf0, 0xf0, 0x00, 0x08, 0x8f, 0x88, 0xf0,
+  0x00, 0x04, 0xf8, 0x4f, 0xb0, 0x00, 0x00, 0xf4, 0x0b, 0x80, 0x00, 0x00,
+  0x80, 0x04, 0x40, 0x00, 0x48, 0x84, 0x48, 0x84, 0x4b, 0xb4, 0x4b, 0xb4,
+  0x00, 0xb4, 0x4b, 0x00, 0x00, 0x0b, 0xb0, 0x00, 0x00, 0x0b, 0xb0, 0x00,
+  0x00, 0xb4, 0x4b, 0x00, 0x4b, 0xb4, 0x4b, 0xb4, 0x48, 0x84, 0x48, 0x84,
+  0x48, 0x80, 0x48, 0x84, 0x4b, 0xb0, 0x4b, 0xb4, 0x00, 0xb4, 0x4b, 0x00,
+  0x00, 0x4b, 0xb4, 0x00, 0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0x80, 0x00,
+  0x00, 0x8b, 0xb8, 0x00, 0x00, 0x88, 0x88, 0x00, 0x48, 0x88, 0x84, 0x8b,
+  0x88, 0xb8, 0x88, 0x04, 0xb0, 0x44, 0x4b, 0x00, 0x04, 0xb0, 0x44, 0x4b,
+  0x00, 0x88, 0xf8, 0x88, 0xb8, 0x88, 0x88, 0x84, 0x8f, 0xf0, 0x88, 0x00,
+  0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0x8f, 0xf0, 0x88, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x0b, 0x80, 0x00, 0x04,
+  0xb0, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x0b, 0x40, 0x00,
+  0x08, 0xb0, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x88, 0xff, 0x80, 0x08, 0x80,
+  0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80,
+  0xff, 0x80, 0x00, 0x04, 0x00, 0x00, 0xbf, 0x40, 0x08, 0xb4, 0xf0, 0x4b,
+  0x00, 0x4b, 0x40, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x8b,
+  0x40, 0x04, 0x40, 0x4f, 0xff, 0x40, 0x00, 0x00, 0xf0, 0x4b, 0xff, 0xf0,
+  0xf4, 0x00, 0xf0, 0xb8, 0x8b, 0xf8, 0x08, 0x84, 0x88, 0x8f, 0x80, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0xbf, 0xfb, 0x40, 0x08, 0xb0, 0x04,
+  0xb0, 0x08, 0x80, 0x00, 0xf0, 0x08, 0x80, 0x00, 0xf0, 0x4b, 0xf8, 0x8b,
+  0x80, 0x48, 0x48, 0x84, 0x00, 0x08, 0xff, 0xbf, 0xbb, 0x00, 0x4f, 0xf0,
+  0x00, 0x08, 0xf4, 0x00, 0x08, 0x4f, 0x88, 0xbb, 0x00, 0x88, 0x80, 0x00,
+  0x08, 0xf8, 0x00, 0x00, 0x00, 0x88, 0x00, 0x4b, 0xff, 0xb8, 0x00, 0xb4,
+  0x00, 0xb8, 0x00, 0xf0, 0x00, 0x88, 0x00, 0xf0, 0x00, 0x88, 0x00, 0x8b,
+  0x88, 0xfb, 0x40, 0x04, 0x88, 0x48, 0x40, 0x4b, 0xff, 0xb4, 0xb4, 0x00,
+  0x4b, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x8b, 0x88, 0x8f, 0x04, 0x88,
+  0x80, 0x00, 0xbf, 0xff, 0x08, 0x80, 0x00, 0xff, 0xff, 0xf8, 0x08, 0x80,
+  0x00, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x8b, 0xb8, 0x80, 0x88, 0x88,
+  0x80, 0x4b, 0xff, 0xbf, 0x80, 0xb4, 0x00, 0xb8, 0x00, 0xf0, 0x00, 0x88,
+  0x00, 0xf0, 0x00, 0x88, 0x00, 0x8b, 0x88, 0xf8, 0x00, 0x04, 0x88, 0x88,
+  0x00, 0x00, 0x00, 0xb8, 0x00, 0x0f, 0xff, 0x80, 0x00, 0x8f, 0x80, 0x00,
+  0x00, 0x08, 0x80, 0x00, 0x00, 0x08, 0xbf, 0xfb, 0x00, 0x08, 0xb0, 0x0b,
+  0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x4b, 0xb4, 0x4b,
+  0xb4, 0x48, 0x84, 0x48, 0x84, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xf8, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x88,
+  0xbb, 0x88, 0x88, 0x88, 0x88, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xff, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0xf0, 0x00, 0x04, 0xf0, 0x8f, 0xfb, 0x40, 0xff,
+  0x00, 0x00, 0x0f, 0x00, 0x00, 0x0f, 0x0f, 0xf8, 0x0f, 0x4b, 0x00, 0x0f,
+  0xf4, 0x00, 0x0f, 0xbb, 0x00, 0x8f, 0x0b, 0xb8, 0x88, 0x04, 0x88, 0x8f,
+  0xf8, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x00,
+  0x88, 0x00, 0x00, 0x88, 0x00, 0x88, 0xbb, 0x88, 0x88, 0x88, 0x88, 0xff,
+  0xbf, 0xbf, 0xb0, 0x0f, 0x48, 0xb0, 0xf0, 0x0f, 0x08, 0x80, 0xf0, 0x0f,
+  0x08, 0x80, 0xf0, 0x8f, 0x88, 0xb4, 0xf8, 0x88, 0x84, 0x84, 0x88, 0x8f,
+  0xbf, 0xfb, 0x00, 0x08, 0xb0, 0x0b, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08,
+  0x80, 0x08, 0x80, 0x4b, 0xb4, 0x4b, 0xb4, 0x48, 0x84, 0x48, 0x84, 0x08,
+  0xff, 0x80, 0xbb, 0x00, 0xbb, 0xf0, 0x00, 0x0f, 0xf4, 0x00, 0x4f, 0x4f,
+  0x88, 0xf4, 0x00, 0x88, 0x00, 0x8f, 0xbf, 0xfb, 0x40, 0x08, 0xb0, 0x04,
+  0xb0, 0x08, 0x80, 0x00, 0xf0, 0x08, 0x80, 0x00, 0xf0, 0x08, 0xf8, 0x8b,
+  0x80, 0x08, 0x88, 0x84, 0x00, 0x08, 0x80, 0x00, 0x00, 0x8f, 0xff, 0x00,
+  0x00, 0x4b, 0xff, 0xbf, 0x80, 0xb4, 0x00, 0xb8, 0x00, 0xf0, 0x00, 0x88,
+  0x00, 0xf0, 0x00, 0x88, 0x00, 0x8b, 0x88, 0xf8, 0x00, 0x04, 0x88, 0x88,
+  0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x0f, 0xff, 0x80, 0xff, 0x8b, 0xfb,
+  0x08, 0xf8, 0x08, 0x08, 0x80, 0x00, 0x08, 0x80, 0x00, 0x8b, 0xb8, 0x80,
+  0x88, 0x88, 0x80, 0x0b, 0xff, 0xf8, 0x88, 0x00, 0x88, 0x4f, 0xfb, 0x80,
+  0x44, 0x08, 0xb8, 0x8b, 0x88, 0xf4, 0x48, 0x88, 0x40, 0x0f, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x0f, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x0f, 0x00, 0x00, 0x0b, 0x88, 0xbf, 0x00, 0x88, 0x80, 0x8f, 0x80, 0x8f,
+  0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08,
+  0x80, 0x04, 0xb8, 0x8f, 0xb4, 0x00, 0x48, 0x84, 0x84, 0x8f, 0xf0, 0x0f,
+  0xf8, 0x08, 0x80, 0x08, 0x80, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0x88, 0x88,
+  0x00, 0x00, 0x4f, 0xf4, 0x00, 0x00, 0x08, 0x80, 0x00, 0x8f, 0x80, 0x0f,
+  0xf0, 0x0f, 0x0b, 0x48, 0x80, 0x0b, 0x4b, 0x8b, 0x40, 0x08, 0xf8, 0xff,
+  0x00, 0x04, 0xf0, 0x88, 0x00, 0x00, 0x80, 0x44, 0x00, 0xff, 0x88, 0xff,
+  0x0b, 0x44, 0xb0, 0x00, 0xbb, 0x00, 0x04, 0xbb, 0x40, 0x8f, 0x44, 0xf8,
+  0x88, 0x44, 0x88, 0x8f, 0xf8, 0x08, 0xff, 0x04, 0xb0, 0x04, 0xb0, 0x00,
+  0xb4, 0x0b, 0x40, 0x00, 0x4b, 0x4b, 0x00, 0x00, 0x0b, 0xf4, 0x00, 0x00,
+  0x04, 0xb0, 0x00, 0x00, 0x0b, 0x40, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x8f,
+  0xff, 0xf8, 0x88, 0x04, 0xb0, 0x00, 0x4b, 0x00, 0x04, 0xb0, 0x44, 0x4f,
+  0x88, 0xb8, 0x48, 0x88, 0x84, 0x04, 0xf8, 0x08, 0x80, 0x08, 0x80, 0x08,
+  0x80, 0x4f, 0x40, 0x0b, 0x80, 0x08, 0x80, 0x08, 0x80, 0x04, 0xf8, 0x88,
+  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x8f, 0x40, 0x08, 0x80,
+  0x08, 0x80, 0x08, 0x80, 0x04, 0xf4, 0x08, 0xb0, 0x08, 0x80, 0x08, 0x80,
+  0x8f, 0x40, 0x4f, 0xb0, 0x44, 0xf4, 0xbb, 0xf4, 0x00, 0x08, 0x40,
+  };
+
+const Atlas Font12AA_Atlas = 
+  {
+  127, Font12AA_Pages, Font12AA_Index, Font12AA_Glyphs, Font12AA_Data, ATLAS_COVERAGE
+  };
+
+sFONT Font12AA = { NULL, 9, 12, &Font12AA_Atlas };
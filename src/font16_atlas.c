@@ -0,0 +1,239 @@
+/*========================================================================
+  spi-oled
+  Glyph atlas for Font16, generated by tools/fontc from fonts/font16.c
+  Do not edit -- run 'make atlases' to regenerate
+========================================================================*/
+#include <stddef.h>
+#include <spi_oled/fonts.h>
+#include <spi_oled/atlas.h>
+
+static const uint16_t Font16_Pages[] = 
+  {
+  0,
+  };
+
+static const uint16_t Font16_Index[] = 
+  {
+  // U+0000
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+  18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+  28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+  38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+  58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+  68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+  78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94,
+  };
+
+static const AtlasGlyph Font16_Glyphs[] = 
+  {
+  {     0,  0,  0,  0,  0 }, // U+0020
+  {     0,  4,  1,  2, 10 }, // U+0021 '!'
+  {    10,  3,  2,  7,  5 }, // U+0022 '"'
+  {    15,  2,  1,  8, 11 }, // U+0023 '#'
+  {    26,  2,  0,  7, 13 }, // U+0024 '$'
+  {    39,  2,  1,  8, 10 }, // U+0025 '%'
+  {    49,  2,  2,  7,  9 }, // U+0026 '&'
+  {    58,  5,  2,  3,  5 }, // U+0027 '''
+  {    63,  4,  1,  4, 12 }, // U+0028 '('
+  {    75,  3,  1,  4, 12 }, // U+0029 ')'
+  {    87,  2,  1,  8,  7 }, // U+002A '*'
+  {    94,  2,  3,  7,  7 }, // U+002B '+'
+  {   101,  4,  9,  3,  5 }, // U+002C ','
+  {   106,  2,  6,  7,  1 }, // U+002D '-'
+  {   107,  4,  9,  2,  2 }, // U+002E '.'
+  {   109,  2,  0,  8, 13 }, // U+002F '/'
+  {   122,  2,  1,  7, 10 }, // U+0030 '0'
+  {   132,  2,  1,  8, 10 }, // U+0031 '1'
+  {   142,  2,  1,  7, 10 }, // U+0032 '2'
+  {   152,  1,  1,  8, 10 }, // U+0033 '3'
+  {   162,  2,  1,  7, 10 }, // U+0034 '4'
+  {   172,  2,  1,  7, 10 }, // U+0035 '5'
+  {   182,  2,  1,  7, 10 }, // U+0036 '6'
+  {   192,  1,  1,  7, 10 }, // U+0037 '7'
+  {   202,  2,  1,  7, 10 }, // U+0038 '8'
+  {   212,  2,  1,  7, 10 }, // U+0039 '9'
+  {   222,  4,  4,  2,  7 }, // U+003A ':'
+  {   229,  4,  4,  4,  9 }, // U+003B ';'
+  {   238,  1,  2,  9,  9 }, // U+003C '<'
+  {   256,  1,  5,  9,  3 }, // U+003D '='
+  {   262,  1,  2,  9,  9 }, // U+003E '>'
+  {   280,  2,  2,  7,  9 }, // U+003F '?'
+  {   289,  2,  1,  6, 11 }, // U+0040 '@'
+  {   300,  1,  2, 10,  9 }, // U+0041 'A'
+  {   318,  1,  2,  8,  9 }, // U+0042 'B'
+  {   327,  1,  2,  9,  9 }, // U+0043 'C'
+  {   345,  1,  2,  9,  9 }, // U+0044 'D'
+  {   363,  1,  2,  8,  9 }, // U+0045 'E'
+  {   372,  1,  2,  9,  9 }, // U+0046 'F'
+  {   390,  1,  2,  9,  9 }, // U+0047 'G'
+  {   408,  1,  2,  9,  9 }, // U+0048 'H'
+  {   426,  2,  2,  8,  9 }, // U+0049 'I'
+  {   435,  1,  2,  9,  9 }, // U+004A 'J'
+  {   453,  1,  2,  9,  9 }, // U+004B 'K'
+  {   471,  1,  2,  9,  9 }, // U+004C 'L'
+  {   489,  0,  2, 11,  9 }, // U+004D 'M'
+  {   507,  1,  2,  9,  9 }, // U+004E 'N'
+  {   525,  1,  2,  9,  9 }, // U+004F 'O'
+  {   543,  1,  2,  8,  9 }, // U+0050 'P'
+  {   552,  1,  2,  9, 11 }, // U+0051 'Q'
+  {   574,  1,  2, 10,  9 }, // U+0052 'R'
+  {   592,  2,  2,  7,  9 }, // U+0053 'S'
+  {   601,  1,  2,  8,  9 }, // U+0054 'T'
+  {   610,  1,  2,  9,  9 }, // U+0055 'U'
+  {   628,  1,  2,  9,  9 }, // U+0056 'V'
+  {   646,  0,  2, 11,  9 }, // U+0057 'W'
+  {   664,  1,  2,  9,  9 }, // U+0058 'X'
+  {   682,  1,  2, 10,  9 }, // U+0059 'Y'
+  {   700,  2,  2,  7,  9 }, // U+005A 'Z'
+  {   709,  5,  1,  4, 12 }, // U+005B '['
+  {   721,  2,  0,  8, 13 }, // U+005C
+  {   734,  3,  1,  4, 12 }, // U+005D ']'
+  {   746,  2,  0,  7,  6 }, // U+005E '^'
+  {   752,  0, 15, 11,  1 }, // U+005F '_'
+  {   754,  4,  0,  3,  3 }, // U+0060 '`'
+  {   757,  2,  4,  8,  7 }, // U+0061 'a'
+  {   764,  1,  1,  9, 10 }, // U+0062 'b'
+  {   784,  1,  4,  8,  7 }, // U+0063 'c'
+  {   791,  1,  1,  9, 10 }, // U+0064 'd'
+  {   811,  1,  4,  9,  7 }, // U+0065 'e'
+  {   825,  2,  1,  9, 10 }, // U+0066 'f'
+  {   845,  1,  4,  9, 10 }, // U+0067 'g'
+  {   865,  1,  1,  9, 10 }, // U+0068 'h'
+  {   885,  2,  1,  8, 10 }, // U+0069 'i'
+  {   895,  2,  1,  6, 13 }, // U+006A 'j'
+  {   908,  1,  1,  9, 10 }, // U+006B 'k'
+  {   928,  2,  1,  8, 10 }, // U+006C 'l'
+  {   938,  1,  4, 10,  7 }, // U+006D 'm'
+  {   952,  1,  4,  9,  7 }, // U+006E 'n'
+  {   966,  1,  4,  9,  7 }, // U+006F 'o'
+  {   980,  1,  4,  9, 10 }, // U+0070 'p'
+  {  1000,  1,  4,  9, 10 }, // U+0071 'q'
+  {  1020,  1,  4,  9,  7 }, // U+0072 'r'
+  {  1034,  2,  4,  7,  7 }, // U+0073 's'
+  {  1041,  1,  1,  8, 10 }, // U+0074 't'
+  {  1051,  1,  4,  9,  7 }, // U+0075 'u'
+  {  1065,  1,  4,  9,  7 }, // U+0076 'v'
+  {  1079,  0,  4, 11,  7 }, // U+0077 'w'
+  {  1093,  1,  4,  9,  7 }, // U+0078 'x'
+  {  1107,  1,  4, 10, 10 }, // U+0079 'y'
+  {  1127,  2,  4,  7,  7 }, // U+007A 'z'
+  {  1134,  3,  1,  4, 12 }, // U+007B '{'
+  {  1146,  5,  1,  2, 12 }, // U+007C '|'
+  {  1158,  4,  1,  4, 12 }, // U+007D '}'
+  {  1170,  2,  5,  7,  3 }, // U+007E '~'
+  };
+
+static const uint8_t Font16_Data[] = 
+  {
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0xc0, 0xee, 0xee,
+  0x44, 0x44, 0x44, 0x36, 0x36, 0x36, 0x36, 0xff, 0x6c, 0xff, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x10, 0x7e, 0xc6, 0xc6, 0xe0, 0x78, 0x3c, 0x0e, 0xc6, 0xc6,
+  0xfc, 0x10, 0x10, 0x60, 0x90, 0x90, 0x63, 0x1e, 0x78, 0xc6, 0x09, 0x09,
+  0x06, 0x3c, 0x60, 0x60, 0x60, 0x30, 0x76, 0xdc, 0xcc, 0x76, 0xe0, 0xe0,
+  0x40, 0x40, 0x40, 0x30, 0x30, 0x60, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0,
+  0x60, 0x30, 0x30, 0xc0, 0xc0, 0x60, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x60, 0xe0, 0xc0, 0x18, 0x18, 0xff, 0xff, 0x3c, 0x7e, 0x66, 0x10, 0x10,
+  0x10, 0xfe, 0x10, 0x10, 0x10, 0x60, 0x40, 0xc0, 0x80, 0x80, 0xfe, 0xc0,
+  0xc0, 0x03, 0x03, 0x06, 0x06, 0x0c, 0x0c, 0x18, 0x30, 0x30, 0x60, 0x60,
+  0xc0, 0xc0, 0x38, 0x6c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x6c, 0x38,
+  0x18, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x3c, 0x66,
+  0xc6, 0xc6, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0xfe, 0x7e, 0xc3, 0x03, 0x06,
+  0x3e, 0x07, 0x03, 0x03, 0xc3, 0x7e, 0x1c, 0x1c, 0x3c, 0x2c, 0x6c, 0x4c,
+  0xcc, 0xfe, 0x0c, 0x3e, 0x7e, 0x60, 0x60, 0x60, 0x7c, 0x46, 0x06, 0x06,
+  0x86, 0x7c, 0x1e, 0x70, 0x60, 0xc0, 0xdc, 0xe6, 0xc6, 0xc6, 0x66, 0x3c,
+  0xfe, 0x86, 0x06, 0x0c, 0x0c, 0x0c, 0x0c, 0x18, 0x18, 0x18, 0x7c, 0xc6,
+  0xc6, 0xc6, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x78, 0xcc, 0xc6, 0xc6,
+  0xce, 0x76, 0x06, 0x0c, 0x1c, 0xf0, 0xc0, 0xc0, 0x00, 0x00, 0x00, 0xc0,
+  0xc0, 0x30, 0x30, 0x00, 0x00, 0x00, 0x60, 0x40, 0x80, 0x80, 0x01, 0x80,
+  0x06, 0x00, 0x08, 0x00, 0x30, 0x00, 0xc0, 0x00, 0x30, 0x00, 0x08, 0x00,
+  0x06, 0x00, 0x01, 0x80, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0xc0, 0x00,
+  0x30, 0x00, 0x08, 0x00, 0x06, 0x00, 0x01, 0x80, 0x06, 0x00, 0x08, 0x00,
+  0x30, 0x00, 0xc0, 0x00, 0x7c, 0xc6, 0xc6, 0x06, 0x1c, 0x30, 0x30, 0x00,
+  0x30, 0x38, 0x44, 0x84, 0x84, 0x9c, 0xa4, 0xa4, 0x9c, 0x80, 0x44, 0x38,
+  0x7e, 0x00, 0x1e, 0x00, 0x12, 0x00, 0x33, 0x00, 0x33, 0x00, 0x3f, 0x00,
+  0x61, 0x80, 0x61, 0x80, 0xf3, 0xc0, 0xfe, 0x63, 0x63, 0x63, 0x7e, 0x63,
+  0x63, 0x63, 0xfe, 0x3e, 0x80, 0x61, 0x80, 0xc0, 0x80, 0xc0, 0x00, 0xc0,
+  0x00, 0xc0, 0x00, 0xc0, 0x80, 0x61, 0x00, 0x3e, 0x00, 0xfe, 0x00, 0x63,
+  0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x63,
+  0x00, 0xfe, 0x00, 0xff, 0x61, 0x61, 0x64, 0x7c, 0x64, 0x61, 0x61, 0xff,
+  0xff, 0x80, 0x60, 0x80, 0x60, 0x80, 0x64, 0x00, 0x7c, 0x00, 0x64, 0x00,
+  0x60, 0x00, 0x60, 0x00, 0xf8, 0x00, 0x3d, 0x00, 0x63, 0x00, 0xc1, 0x00,
+  0xc0, 0x00, 0xc0, 0x00, 0xcf, 0x80, 0xc3, 0x00, 0x63, 0x00, 0x3e, 0x00,
+  0xf7, 0x80, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x7f, 0x00, 0x63, 0x00,
+  0x63, 0x00, 0x63, 0x00, 0xf7, 0x80, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0xff, 0x3f, 0x80, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+  0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0x7c, 0x00, 0xf7, 0x80, 0x63,
+  0x00, 0x66, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x7c, 0x00, 0x66, 0x00, 0x63,
+  0x00, 0xf3, 0x80, 0xfc, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+  0x00, 0x30, 0x80, 0x30, 0x80, 0x30, 0x80, 0xff, 0x80, 0xe0, 0xe0, 0x60,
+  0xc0, 0x71, 0xc0, 0x7b, 0xc0, 0x6a, 0xc0, 0x6e, 0xc0, 0x64, 0xc0, 0x60,
+  0xc0, 0xfb, 0xe0, 0xe7, 0x80, 0x63, 0x00, 0x73, 0x00, 0x7b, 0x00, 0x6b,
+  0x00, 0x6f, 0x00, 0x67, 0x00, 0x63, 0x00, 0xf3, 0x00, 0x3e, 0x00, 0x63,
+  0x00, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0x63,
+  0x00, 0x3e, 0x00, 0xfe, 0x63, 0x63, 0x63, 0x63, 0x7e, 0x60, 0x60, 0xfc,
+  0x3e, 0x00, 0x63, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80,
+  0xc1, 0x80, 0x63, 0x00, 0x3e, 0x00, 0x19, 0x80, 0x3f, 0x00, 0xfe, 0x00,
+  0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x7c, 0x00, 0x66, 0x00, 0x63, 0x00,
+  0x63, 0x00, 0xf9, 0xc0, 0x7e, 0xc6, 0xc6, 0xe0, 0x7c, 0x0e, 0xc6, 0xc6,
+  0xfc, 0xff, 0x99, 0x99, 0x99, 0x18, 0x18, 0x18, 0x18, 0x7e, 0xf7, 0x80,
+  0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00,
+  0x63, 0x00, 0x3e, 0x00, 0xf7, 0x80, 0x63, 0x00, 0x63, 0x00, 0x36, 0x00,
+  0x36, 0x00, 0x36, 0x00, 0x14, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0xfb, 0xe0,
+  0x60, 0xc0, 0x64, 0xc0, 0x6e, 0xc0, 0x6e, 0xc0, 0x2a, 0x80, 0x3b, 0x80,
+  0x3b, 0x80, 0x31, 0x80, 0xf7, 0x80, 0x63, 0x00, 0x36, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x63, 0x00, 0xf7, 0x80, 0xf3, 0xc0,
+  0x61, 0x80, 0x33, 0x00, 0x1e, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x0c, 0x00, 0x3f, 0x00, 0xfe, 0x86, 0x8c, 0x18, 0x10, 0x30, 0x62, 0xc2,
+  0xfe, 0xf0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xf0, 0xc0, 0xc0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0c, 0x0c, 0x06, 0x06,
+  0x03, 0x03, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0xf0, 0x10, 0x28, 0x28, 0x44, 0x82, 0x82, 0xff, 0xe0, 0x80, 0x40,
+  0x20, 0x7c, 0x06, 0x06, 0x7e, 0xc6, 0xce, 0x77, 0xe0, 0x00, 0x60, 0x00,
+  0x60, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+  0x73, 0x00, 0xee, 0x00, 0x3d, 0x63, 0xc1, 0xc0, 0xc1, 0x63, 0x3e, 0x07,
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x3b, 0x00, 0x67, 0x00, 0xc3, 0x00, 0xc3,
+  0x00, 0xc3, 0x00, 0x67, 0x00, 0x3b, 0x80, 0x3e, 0x00, 0x63, 0x00, 0xc1,
+  0x80, 0xff, 0x80, 0xc0, 0x00, 0x61, 0x80, 0x3f, 0x00, 0x1f, 0x80, 0x30,
+  0x00, 0x30, 0x00, 0xfe, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+  0x00, 0x30, 0x00, 0xfe, 0x00, 0x3b, 0x80, 0x67, 0x00, 0xc3, 0x00, 0xc3,
+  0x00, 0xc3, 0x00, 0x67, 0x00, 0x3b, 0x00, 0x03, 0x00, 0x03, 0x00, 0x3e,
+  0x00, 0xe0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x63,
+  0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0xf7, 0x80, 0x18, 0x18, 0x00,
+  0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0x18, 0x18, 0x00, 0xfc, 0x0c,
+  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0xf8, 0xe0, 0x00, 0x60, 0x00,
+  0x60, 0x00, 0x6f, 0x00, 0x6c, 0x00, 0x78, 0x00, 0x78, 0x00, 0x6c, 0x00,
+  0x66, 0x00, 0xef, 0x80, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0xff, 0xff, 0x00, 0x6d, 0x80, 0x6d, 0x80, 0x6d, 0x80, 0x6d, 0x80,
+  0x6d, 0x80, 0xed, 0xc0, 0xee, 0x00, 0x73, 0x00, 0x63, 0x00, 0x63, 0x00,
+  0x63, 0x00, 0x63, 0x00, 0xf7, 0x80, 0x3e, 0x00, 0x63, 0x00, 0xc1, 0x80,
+  0xc1, 0x80, 0xc1, 0x80, 0x63, 0x00, 0x3e, 0x00, 0xee, 0x00, 0x73, 0x00,
+  0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x73, 0x00, 0x6e, 0x00, 0x60, 0x00,
+  0x60, 0x00, 0xf8, 0x00, 0x3b, 0x80, 0x67, 0x00, 0xc3, 0x00, 0xc3, 0x00,
+  0xc3, 0x00, 0x67, 0x00, 0x3b, 0x00, 0x03, 0x00, 0x03, 0x00, 0x0f, 0x80,
+  0xf7, 0x00, 0x39, 0x80, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,
+  0xfe, 0x00, 0x7e, 0xc6, 0xf0, 0x7c, 0x0e, 0xc6, 0xfc, 0x30, 0x30, 0x30,
+  0xfe, 0x30, 0x30, 0x30, 0x30, 0x31, 0x1e, 0xe7, 0x00, 0x63, 0x00, 0x63,
+  0x00, 0x63, 0x00, 0x63, 0x00, 0x67, 0x00, 0x3b, 0x80, 0xf7, 0x80, 0x63,
+  0x00, 0x63, 0x00, 0x36, 0x00, 0x36, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0xf1,
+  0xe0, 0x60, 0xc0, 0x64, 0xc0, 0x6e, 0xc0, 0x3b, 0x80, 0x3b, 0x80, 0x31,
+  0x80, 0xf7, 0x80, 0x36, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0x00, 0x36,
+  0x00, 0xf7, 0x80, 0xf3, 0xc0, 0x61, 0x80, 0x33, 0x00, 0x33, 0x00, 0x16,
+  0x00, 0x1e, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x7c, 0x00, 0xfe,
+  0x86, 0x0c, 0x38, 0x60, 0xc2, 0xfe, 0x30, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0xc0, 0x60, 0x60, 0x60, 0x60, 0x30, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x30, 0x60, 0x60, 0x60, 0x60, 0xc0, 0x60, 0x92, 0x0c,
+  };
+
+const Atlas Font16_Atlas = 
+  {
+  127, Font16_Pages, Font16_Index, Font16_Glyphs, Font16_Data, ATLAS_BITS
+  };
+
+sFONT Font16 = { NULL, 11, 16, &Font16_Atlas };
@@ -0,0 +1,292 @@
+/*========================================================================
+  spi-oled
+  Glyph atlas for Font20, generated by tools/fontc from fonts/font20.c
+  Do not edit -- run 'make atlases' to regenerate
+========================================================================*/
+#include <stddef.h>
+#include <spi_oled/fonts.h>
+#include <spi_oled/atlas.h>
+
+static const uint16_t Font20_Pages[] = 
+  {
+  0,
+  };
+
+static const uint16_t Font20_Index[] = 
+  {
+  // U+0000
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+  18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+  28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+  38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+  58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+  68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+  78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94,
+  };
+
+static const AtlasGlyph Font20_Glyphs[] = 
+  {
+  {     0,  0,  0,  0,  0 }, // U+0020
+  {     0,  5,  1,  3, 13 }, // U+0021 '!'
+  {    13,  3,  2,  8,  6 }, // U+0022 '"'
+  {    19,  2,  0, 10, 16 }, // U+0023 '#'
+  {    51,  3,  0,  8, 16 }, // U+0024 '$'
+  {    67,  2,  1,  9, 13 }, // U+0025 '%'
+  {    93,  3,  3,  9, 11 }, // U+0026 '&'
+  {   115,  6,  2,  3,  6 }, // U+0027 '''
+  {   121,  6,  1,  4, 16 }, // U+0028 '('
+  {   137,  4,  1,  4, 16 }, // U+0029 ')'
+  {   153,  3,  1,  8,  9 }, // U+002A '*'
+  {   162,  2,  3, 10, 10 }, // U+002B '+'
+  {   182,  5, 11,  4,  6 }, // U+002C ','
+  {   188,  2,  7,  9,  2 }, // U+002D '-'
+  {   192,  6, 11,  3,  3 }, // U+002E '.'
+  {   195,  3,  0,  8, 16 }, // U+002F '/'
+  {   211,  2,  1,  9, 13 }, // U+0030 '0'
+  {   237,  3,  1,  8, 13 }, // U+0031 '1'
+  {   250,  2,  1,  9, 13 }, // U+0032 '2'
+  {   276,  1,  1, 10, 13 }, // U+0033 '3'
+  {   302,  2,  1,  9, 13 }, // U+0034 '4'
+  {   328,  2,  1,  9, 13 }, // U+0035 '5'
+  {   354,  2,  1,  9, 13 }, // U+0036 '6'
+  {   380,  2,  1,  9, 13 }, // U+0037 '7'
+  {   406,  2,  1,  9, 13 }, // U+0038 '8'
+  {   432,  2,  1,  9, 13 }, // U+0039 '9'
+  {   458,  6,  5,  3,  9 }, // U+003A ':'
+  {   467,  5,  5,  5, 11 }, // U+003B ';'
+  {   478,  1,  3, 11, 11 }, // U+003C '<'
+  {   500,  1,  5, 11,  6 }, // U+003D '='
+  {   512,  2,  3, 11, 11 }, // U+003E '>'
+  {   534,  3,  2,  8, 12 }, // U+003F '?'
+  {   546,  3,  1,  7, 14 }, // U+0040 '@'
+  {   560,  1,  2, 12, 12 }, // U+0041 'A'
+  {   584,  2,  2, 10, 12 }, // U+0042 'B'
+  {   608,  2,  2, 10, 12 }, // U+0043 'C'
+  {   632,  1,  2, 11, 12 }, // U+0044 'D'
+  {   656,  2,  2, 10, 12 }, // U+0045 'E'
+  {   680,  2,  2, 10, 12 }, // U+0046 'F'
+  {   704,  2,  2, 11, 12 }, // U+0047 'G'
+  {   728,  2,  2, 10, 12 }, // U+0048 'H'
+  {   752,  3,  2,  8, 12 }, // U+0049 'I'
+  {   764,  2,  2, 11, 12 }, // U+004A 'J'
+  {   788,  2,  2, 11, 12 }, // U+004B 'K'
+  {   812,  2,  2, 10, 12 }, // U+004C 'L'
+  {   836,  1,  2, 12, 12 }, // U+004D 'M'
+  {   860,  2,  2, 10, 12 }, // U+004E 'N'
+  {   884,  2,  2, 10, 12 }, // U+004F 'O'
+  {   908,  2,  2, 10, 12 }, // U+0050 'P'
+  {   932,  2,  2, 10, 15 }, // U+0051 'Q'
+  {   962,  2,  2, 11, 12 }, // U+0052 'R'
+  {   986,  2,  2, 10, 12 }, // U+0053 'S'
+  {  1010,  2,  2, 10, 12 }, // U+0054 'T'
+  {  1034,  2,  2, 10, 12 }, // U+0055 'U'
+  {  1058,  1,  2, 11, 12 }, // U+0056 'V'
+  {  1082,  1,  2, 13, 12 }, // U+0057 'W'
+  {  1106,  1,  2, 11, 12 }, // U+0058 'X'
+  {  1130,  2,  2, 10, 12 }, // U+0059 'Y'
+  {  1154,  3,  2,  8, 12 }, // U+005A 'Z'
+  {  1166,  6,  1,  4, 16 }, // U+005B '['
+  {  1182,  3,  0,  8, 16 }, // U+005C
+  {  1198,  4,  1,  4, 16 }, // U+005D ']'
+  {  1214,  2,  1,  9,  6 }, // U+005E '^'
+  {  1226,  0, 18, 14,  2 }, // U+005F '_'
+  {  1230,  5,  1,  4,  3 }, // U+0060 '`'
+  {  1233,  2,  5, 10,  9 }, // U+0061 'a'
+  {  1251,  1,  1, 11, 13 }, // U+0062 'b'
+  {  1277,  2,  5, 10,  9 }, // U+0063 'c'
+  {  1295,  2,  1, 11, 13 }, // U+0064 'd'
+  {  1321,  2,  5, 10,  9 }, // U+0065 'e'
+  {  1339,  3,  1,  9, 13 }, // U+0066 'f'
+  {  1365,  2,  5, 11, 13 }, // U+0067 'g'
+  {  1391,  2,  1, 10, 13 }, // U+0068 'h'
+  {  1417,  3,  1,  8, 13 }, // U+0069 'i'
+  {  1430,  2,  1,  8, 17 }, // U+006A 'j'
+  {  1447,  2,  1, 10, 13 }, // U+006B 'k'
+  {  1473,  3,  1,  8, 13 }, // U+006C 'l'
+  {  1486,  1,  5, 12,  9 }, // U+006D 'm'
+  {  1504,  2,  5, 10,  9 }, // U+006E 'n'
+  {  1522,  2,  5, 10,  9 }, // U+006F 'o'
+  {  1540,  1,  5, 11, 13 }, // U+0070 'p'
+  {  1566,  2,  5, 11, 13 }, // U+0071 'q'
+  {  1592,  2,  5, 10,  9 }, // U+0072 'r'
+  {  1610,  3,  5,  8,  9 }, // U+0073 's'
+  {  1619,  2,  2, 10, 12 }, // U+0074 't'
+  {  1643,  2,  5, 10,  9 }, // U+0075 'u'
+  {  1661,  1,  5, 11,  9 }, // U+0076 'v'
+  {  1679,  1,  5, 11,  9 }, // U+0077 'w'
+  {  1697,  2,  5, 10,  9 }, // U+0078 'x'
+  {  1715,  1,  5, 11, 13 }, // U+0079 'y'
+  {  1741,  3,  5,  8,  9 }, // U+007A 'z'
+  {  1750,  4,  1,  6, 16 }, // U+007B '{'
+  {  1766,  6,  1,  2, 16 }, // U+007C '|'
+  {  1782,  3,  1,  6, 16 }, // U+007D '}'
+  {  1798,  2,  6, 10,  4 }, // U+007E '~'
+  };
+
+static const uint8_t Font20_Data[] = 
+  {
+  0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x40, 0x40, 0x00, 0x00, 0xe0,
+  0xe0, 0xe7, 0xe7, 0xe7, 0x42, 0x42, 0x42, 0x33, 0x00, 0x33, 0x00, 0x33,
+  0x00, 0x33, 0x00, 0x33, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x33, 0x00, 0x33,
+  0x00, 0xff, 0xc0, 0xff, 0xc0, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33,
+  0x00, 0x33, 0x00, 0x18, 0x18, 0x3f, 0x7f, 0xc3, 0xc0, 0xf8, 0x7e, 0x07,
+  0xc3, 0xc3, 0xfe, 0xfc, 0x18, 0x18, 0x18, 0x70, 0x00, 0x88, 0x00, 0x88,
+  0x00, 0x88, 0x00, 0x71, 0x80, 0x07, 0x80, 0x3e, 0x00, 0xf0, 0x00, 0xc7,
+  0x00, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x07, 0x00, 0x1f, 0x00, 0x7f,
+  0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x79, 0x80, 0xff, 0x80, 0xcf,
+  0x00, 0xc6, 0x00, 0xff, 0x80, 0x3d, 0x80, 0xe0, 0xe0, 0xe0, 0x40, 0x40,
+  0x40, 0x30, 0x30, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0x60, 0x60, 0x60, 0x30, 0x30, 0xc0, 0xc0, 0x60, 0x60, 0x60, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0x18, 0x18, 0x18,
+  0xdb, 0xff, 0x3c, 0x3c, 0x7e, 0x66, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x0c, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00,
+  0x0c, 0x00, 0x70, 0x60, 0x60, 0xc0, 0xc0, 0x80, 0xff, 0x80, 0xff, 0x80,
+  0xe0, 0xe0, 0xe0, 0x03, 0x03, 0x06, 0x06, 0x06, 0x0c, 0x0c, 0x18, 0x18,
+  0x30, 0x30, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0x3e, 0x00, 0x7f, 0x00, 0x63,
+  0x00, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0x63, 0x00, 0x7f, 0x00, 0x3e, 0x00, 0x18, 0xf8, 0xf8,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff, 0x3e, 0x00,
+  0x7f, 0x00, 0xe3, 0x80, 0xc1, 0x80, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00,
+  0x0c, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xff, 0x80, 0xff, 0x80,
+  0x1f, 0x00, 0x7f, 0x80, 0x61, 0xc0, 0x00, 0xc0, 0x01, 0xc0, 0x0f, 0x80,
+  0x0f, 0x80, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xc1, 0xc0, 0xff, 0x80,
+  0x7f, 0x00, 0x07, 0x00, 0x0f, 0x00, 0x0f, 0x00, 0x1b, 0x00, 0x33, 0x00,
+  0x33, 0x00, 0x63, 0x00, 0xc3, 0x00, 0xff, 0x80, 0xff, 0x80, 0x03, 0x00,
+  0x0f, 0x80, 0x0f, 0x80, 0x7f, 0x00, 0x7f, 0x00, 0x60, 0x00, 0x60, 0x00,
+  0x7e, 0x00, 0x7f, 0x00, 0x63, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80,
+  0xc3, 0x80, 0xff, 0x00, 0x7e, 0x00, 0x0f, 0x80, 0x3f, 0x80, 0x78, 0x00,
+  0x60, 0x00, 0xe0, 0x00, 0xde, 0x00, 0xff, 0x00, 0xe3, 0x80, 0xc1, 0x80,
+  0xc1, 0x80, 0x63, 0x80, 0x7f, 0x00, 0x1e, 0x00, 0xff, 0x80, 0xff, 0x80,
+  0xc1, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00,
+  0x06, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3e, 0x00,
+  0x7f, 0x00, 0xe3, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x7f, 0x00,
+  0xe3, 0x80, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80, 0x7f, 0x00, 0x3e, 0x00,
+  0x3c, 0x00, 0x7f, 0x00, 0xe3, 0x00, 0xc1, 0x80, 0xc1, 0x80, 0xe3, 0x80,
+  0x7f, 0x80, 0x3d, 0x80, 0x03, 0x80, 0x03, 0x00, 0x0f, 0x00, 0xfe, 0x00,
+  0xf8, 0x00, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0x38,
+  0x38, 0x38, 0x00, 0x00, 0x00, 0x70, 0x60, 0xc0, 0xc0, 0x80, 0x00, 0x60,
+  0x01, 0xe0, 0x07, 0x80, 0x0e, 0x00, 0x38, 0x00, 0xf0, 0x00, 0x38, 0x00,
+  0x0e, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x60, 0xff, 0xe0, 0xff, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0xc0, 0x00, 0xf0, 0x00,
+  0x3c, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x01, 0xe0, 0x03, 0x80, 0x0e, 0x00,
+  0x3c, 0x00, 0xf0, 0x00, 0xc0, 0x00, 0x7c, 0xfe, 0xc3, 0xc3, 0x03, 0x0e,
+  0x1c, 0x18, 0x00, 0x00, 0x38, 0x38, 0x1c, 0x64, 0x42, 0x82, 0x82, 0x8e,
+  0x92, 0x92, 0x92, 0x8e, 0x80, 0x40, 0x42, 0x3c, 0x3f, 0x00, 0x3f, 0x00,
+  0x07, 0x00, 0x0d, 0x80, 0x0d, 0x80, 0x19, 0x80, 0x18, 0xc0, 0x3f, 0xc0,
+  0x3f, 0xc0, 0x60, 0x60, 0xf0, 0xf0, 0xf0, 0xf0, 0xfe, 0x00, 0xff, 0x00,
+  0x61, 0x80, 0x61, 0x80, 0x63, 0x80, 0x7f, 0x00, 0x7f, 0x80, 0x61, 0xc0,
+  0x60, 0xc0, 0x60, 0xc0, 0xff, 0xc0, 0xff, 0x80, 0x1e, 0xc0, 0x3f, 0xc0,
+  0x71, 0xc0, 0xe0, 0xc0, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00,
+  0xe0, 0xc0, 0x71, 0xc0, 0x3f, 0x80, 0x1f, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0x61, 0xc0, 0x60, 0xe0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60,
+  0x60, 0xe0, 0x61, 0xc0, 0xff, 0x80, 0xff, 0x00, 0xff, 0xc0, 0xff, 0xc0,
+  0x60, 0xc0, 0x60, 0xc0, 0x66, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x66, 0x00,
+  0x60, 0xc0, 0x60, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xff, 0xc0,
+  0x60, 0xc0, 0x60, 0xc0, 0x66, 0x00, 0x7e, 0x00, 0x7e, 0x00, 0x66, 0x00,
+  0x60, 0x00, 0x60, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x1e, 0xc0, 0x7f, 0xc0,
+  0x61, 0xc0, 0xc0, 0xc0, 0xc0, 0x00, 0xc0, 0x00, 0xc7, 0xe0, 0xc7, 0xe0,
+  0xc0, 0xc0, 0x60, 0xc0, 0x7f, 0xc0, 0x1f, 0x00, 0xf3, 0xc0, 0xf3, 0xc0,
+  0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x7f, 0x80, 0x7f, 0x80, 0x61, 0x80,
+  0x61, 0x80, 0x61, 0x80, 0xf3, 0xc0, 0xf3, 0xc0, 0xff, 0xff, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff, 0x0f, 0xe0, 0x0f, 0xe0,
+  0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0xc1, 0x80, 0xc1, 0x80,
+  0xc1, 0x80, 0xc3, 0x80, 0xff, 0x00, 0x3e, 0x00, 0xfb, 0xe0, 0xfb, 0xe0,
+  0x63, 0x80, 0x66, 0x00, 0x6c, 0x00, 0x7c, 0x00, 0x76, 0x00, 0x63, 0x00,
+  0x63, 0x00, 0x61, 0x80, 0xf9, 0xe0, 0xf8, 0xe0, 0xfc, 0x00, 0xfc, 0x00,
+  0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xc0,
+  0x30, 0xc0, 0x30, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0,
+  0x70, 0xe0, 0x79, 0xe0, 0x69, 0x60, 0x6f, 0x60, 0x6f, 0x60, 0x66, 0x60,
+  0x66, 0x60, 0x60, 0x60, 0xf9, 0xf0, 0xf9, 0xf0, 0xe7, 0xc0, 0xf7, 0xc0,
+  0x71, 0x80, 0x79, 0x80, 0x79, 0x80, 0x6d, 0x80, 0x6d, 0x80, 0x67, 0x80,
+  0x67, 0x80, 0x63, 0x80, 0xfb, 0x80, 0xf9, 0x80, 0x1e, 0x00, 0x3f, 0x00,
+  0x73, 0x80, 0xe1, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xe1, 0xc0, 0x73, 0x80, 0x3f, 0x00, 0x1e, 0x00, 0xff, 0x00, 0xff, 0x80,
+  0x61, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x61, 0xc0, 0x7f, 0x80, 0x7f, 0x00,
+  0x60, 0x00, 0x60, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x1e, 0x00, 0x3f, 0x00,
+  0x73, 0x80, 0xe1, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xe1, 0xc0, 0x73, 0x80, 0x3f, 0x00, 0x1e, 0x00, 0x1e, 0xc0, 0x3f, 0xc0,
+  0x33, 0x80, 0xff, 0x00, 0xff, 0x80, 0x61, 0xc0, 0x60, 0xc0, 0x61, 0xc0,
+  0x7f, 0x80, 0x7f, 0x00, 0x63, 0x80, 0x61, 0x80, 0x61, 0xc0, 0xf8, 0xe0,
+  0xf8, 0x60, 0x3e, 0xc0, 0x7f, 0xc0, 0xe1, 0xc0, 0xc0, 0xc0, 0xe0, 0x00,
+  0x7e, 0x00, 0x1f, 0x80, 0x01, 0xc0, 0xc0, 0xc0, 0xe1, 0xc0, 0xff, 0x80,
+  0xdf, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0xcc, 0xc0,
+  0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3f, 0x00,
+  0x3f, 0x00, 0xf3, 0xc0, 0xf3, 0xc0, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80,
+  0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x73, 0x80, 0x3f, 0x00,
+  0x1e, 0x00, 0xf1, 0xe0, 0xf1, 0xe0, 0x60, 0xc0, 0x60, 0xc0, 0x31, 0x80,
+  0x31, 0x80, 0x1b, 0x00, 0x1b, 0x00, 0x1b, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+  0x0e, 0x00, 0xf8, 0xf8, 0xf8, 0xf8, 0x60, 0x30, 0x67, 0x30, 0x67, 0x30,
+  0x67, 0x30, 0x6d, 0xb0, 0x2d, 0xa0, 0x38, 0xe0, 0x38, 0xe0, 0x38, 0xe0,
+  0x30, 0x60, 0xf1, 0xe0, 0xf1, 0xe0, 0x60, 0xc0, 0x31, 0x80, 0x1b, 0x00,
+  0x0e, 0x00, 0x0e, 0x00, 0x1b, 0x00, 0x31, 0x80, 0x60, 0xc0, 0xf1, 0xe0,
+  0xf1, 0xe0, 0xf3, 0xc0, 0xf3, 0xc0, 0x61, 0x80, 0x33, 0x00, 0x1e, 0x00,
+  0x1e, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3f, 0x00,
+  0x3f, 0x00, 0xff, 0xff, 0xc3, 0xc6, 0x0c, 0x18, 0x18, 0x30, 0x63, 0xc3,
+  0xff, 0xff, 0xf0, 0xf0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xf0, 0xf0, 0xc0, 0xc0, 0x60, 0x60, 0x60, 0x30,
+  0x30, 0x18, 0x18, 0x0c, 0x0c, 0x06, 0x06, 0x06, 0x03, 0x03, 0xf0, 0xf0,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0xf0, 0xf0, 0x08, 0x00, 0x1c, 0x00, 0x36, 0x00, 0x63, 0x00, 0xc1, 0x80,
+  0x80, 0x80, 0xff, 0xfc, 0xff, 0xfc, 0x80, 0x60, 0x10, 0x3f, 0x00, 0x7f,
+  0x80, 0x01, 0x80, 0x3f, 0x80, 0x7f, 0x80, 0xe1, 0x80, 0xc3, 0x80, 0xff,
+  0xc0, 0x7d, 0xc0, 0xe0, 0x00, 0xe0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x6f,
+  0x00, 0x7f, 0xc0, 0x70, 0xc0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x70,
+  0xc0, 0xff, 0xc0, 0xef, 0x00, 0x1e, 0xc0, 0x7f, 0xc0, 0x60, 0xc0, 0xc0,
+  0xc0, 0xc0, 0x00, 0xc0, 0x00, 0xe0, 0xc0, 0x7f, 0xc0, 0x3f, 0x00, 0x01,
+  0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x1e, 0xc0, 0x7f, 0xc0, 0x61,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe1, 0xc0, 0x7f, 0xe0, 0x1e,
+  0xe0, 0x1e, 0x00, 0x7f, 0x80, 0x61, 0x80, 0xff, 0xc0, 0xff, 0xc0, 0xc0,
+  0x00, 0x60, 0xc0, 0x7f, 0xc0, 0x1f, 0x00, 0x1f, 0x80, 0x3f, 0x80, 0x30,
+  0x00, 0x30, 0x00, 0xff, 0x00, 0xff, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30,
+  0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x00, 0xff, 0x00, 0x1e, 0xe0, 0x7f,
+  0xe0, 0x61, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x61, 0xc0, 0x7f,
+  0xc0, 0x1e, 0xc0, 0x00, 0xc0, 0x01, 0xc0, 0x3f, 0x80, 0x3f, 0x00, 0xe0,
+  0x00, 0xe0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7f, 0x80, 0x71,
+  0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0xf3, 0xc0, 0xf3,
+  0xc0, 0x18, 0x18, 0x00, 0x00, 0xf8, 0xf8, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0xff, 0xff, 0x0c, 0x0c, 0x00, 0x00, 0x7f, 0x7f, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x07, 0xfe, 0xfc, 0xe0, 0x00, 0xe0, 0x00, 0x60,
+  0x00, 0x60, 0x00, 0x6f, 0x80, 0x6f, 0x80, 0x6c, 0x00, 0x78, 0x00, 0x78,
+  0x00, 0x6c, 0x00, 0x66, 0x00, 0xe7, 0xc0, 0xe7, 0xc0, 0xf8, 0xf8, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xff, 0xff, 0xfd, 0xc0,
+  0xff, 0xe0, 0x66, 0x60, 0x66, 0x60, 0x66, 0x60, 0x66, 0x60, 0x66, 0x60,
+  0xf7, 0x70, 0xf7, 0x70, 0xef, 0x00, 0xff, 0x80, 0x71, 0x80, 0x61, 0x80,
+  0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0xf3, 0xc0, 0xf3, 0xc0, 0x1e, 0x00,
+  0x7f, 0x80, 0x61, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x61, 0x80,
+  0x7f, 0x80, 0x1e, 0x00, 0xef, 0x00, 0xff, 0xc0, 0x70, 0xc0, 0x60, 0x60,
+  0x60, 0x60, 0x60, 0x60, 0x70, 0xc0, 0x7f, 0xc0, 0x6f, 0x00, 0x60, 0x00,
+  0x60, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x1e, 0xe0, 0x7f, 0xe0, 0x61, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x61, 0xc0, 0x7f, 0xc0, 0x1e, 0xc0,
+  0x00, 0xc0, 0x00, 0xc0, 0x03, 0xe0, 0x03, 0xe0, 0xf3, 0x80, 0xf7, 0xc0,
+  0x3c, 0xc0, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x00,
+  0xff, 0x00, 0x3f, 0xff, 0xc3, 0xf0, 0x7e, 0x0f, 0xc3, 0xff, 0xfc, 0x30,
+  0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x80, 0xff, 0x80, 0x30, 0x00, 0x30,
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xc0, 0x3f, 0xc0, 0x1f, 0x00, 0xe3,
+  0x80, 0xe3, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x63,
+  0x80, 0x7f, 0xc0, 0x3d, 0xc0, 0xf1, 0xe0, 0xf1, 0xe0, 0x60, 0xc0, 0x31,
+  0x80, 0x31, 0x80, 0x1b, 0x00, 0x1b, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xf1,
+  0xe0, 0xf1, 0xe0, 0x64, 0xc0, 0x64, 0xc0, 0x6f, 0xc0, 0x3b, 0x80, 0x3b,
+  0x80, 0x31, 0x80, 0x31, 0x80, 0xf3, 0xc0, 0xf3, 0xc0, 0x33, 0x00, 0x1e,
+  0x00, 0x0c, 0x00, 0x1e, 0x00, 0x33, 0x00, 0xf3, 0xc0, 0xf3, 0xc0, 0xf1,
+  0xe0, 0xf1, 0xe0, 0x60, 0xc0, 0x31, 0x80, 0x31, 0x80, 0x1b, 0x00, 0x1f,
+  0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x18, 0x00, 0xfe, 0x00, 0xfe,
+  0x00, 0xff, 0xff, 0xc6, 0x0c, 0x18, 0x30, 0x63, 0xff, 0xff, 0x1c, 0x3c,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0xe0, 0x70, 0x30, 0x30, 0x30, 0x30,
+  0x3c, 0x1c, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xf0, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x38, 0x1c, 0x38, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xe0, 0x38, 0x00,
+  0xfc, 0xc0, 0xcf, 0xc0, 0x07, 0x80,
+  };
+
+const Atlas Font20_Atlas = 
+  {
+  127, Font20_Pages, Font20_Index, Font20_Glyphs, Font20_Data, ATLAS_BITS
+  };
+
+sFONT Font20 = { NULL, 14, 20, &Font20_Atlas };
@@ -0,0 +1,337 @@
+/*========================================================================
+  spi-oled
+  Glyph atlas for Font24, generated by tools/fontc from fonts/font24.c
+  Do not edit -- run 'make atlases' to regenerate
+========================================================================*/
+#include <stddef.h>
+#include <spi_oled/fonts.h>
+#include <spi_oled/atlas.h>
+
+static const uint16_t Font24_Pages[] = 
+  {
+  0,
+  };
+
+static const uint16_t Font24_Index[] = 
+  {
+  // U+0000
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+  18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+  28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+  38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+  58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+  68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+  78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94,
+  };
+
+static const AtlasGlyph Font24_Glyphs[] = 
+  {
+  {     0,  0,  0,  0,  0 }, // U+0020
+  {     0,  6,  2,  3, 15 }, // U+0021 '!'
+  {    15,  4,  3,  8,  7 }, // U+0022 '"'
+  {    22,  2,  2, 11, 16 }, // U+0023 '#'
+  {    54,  3,  1,  9, 19 }, // U+0024 '$'
+  {    92,  3,  2, 10, 15 }, // U+0025 '%'
+  {   122,  3,  4, 11, 13 }, // U+0026 '&'
+  {   148,  6,  3,  3,  7 }, // U+0027 '''
+  {   155,  7,  2,  6, 18 }, // U+0028 '('
+  {   173,  3,  2,  6, 18 }, // U+0029 ')'
+  {   191,  3,  2, 10, 10 }, // U+002A '*'
+  {   211,  2,  4, 12, 12 }, // U+002B '+'
+  {   235,  6, 14,  5,  7 }, // U+002C ','
+  {   242,  3,  9, 10,  2 }, // U+002D '-'
+  {   246,  6, 14,  4,  3 }, // U+002E '.'
+  {   249,  3,  0, 10, 20 }, // U+002F '/'
+  {   289,  3,  2, 10, 15 }, // U+0030 '0'
+  {   319,  3,  2, 10, 15 }, // U+0031 '1'
+  {   349,  2,  2, 11, 15 }, // U+0032 '2'
+  {   379,  3,  2, 10, 15 }, // U+0033 '3'
+  {   409,  2,  2, 11, 15 }, // U+0034 '4'
+  {   439,  2,  2, 11, 15 }, // U+0035 '5'
+  {   469,  3,  2, 10, 15 }, // U+0036 '6'
+  {   499,  3,  2, 10, 15 }, // U+0037 '7'
+  {   529,  3,  2, 10, 15 }, // U+0038 '8'
+  {   559,  3,  2, 10, 15 }, // U+0039 '9'
+  {   589,  6,  6,  4, 11 }, // U+003A ':'
+  {   600,  6,  6,  6, 13 }, // U+003B ';'
+  {   613,  0,  4, 14, 13 }, // U+003C '<'
+  {   639,  1,  7, 13,  6 }, // U+003D '='
+  {   651,  1,  4, 14, 13 }, // U+003E '>'
+  {   677,  3,  3,  9, 14 }, // U+003F '?'
+  {   705,  3,  2, 10, 17 }, // U+0040 '@'
+  {   739,  0,  3, 16, 14 }, // U+0041 'A'
+  {   767,  1,  3, 13, 14 }, // U+0042 'B'
+  {   795,  2,  3, 12, 14 }, // U+0043 'C'
+  {   823,  1,  3, 13, 14 }, // U+0044 'D'
+  {   851,  1,  3, 12, 14 }, // U+0045 'E'
+  {   879,  2,  3, 12, 14 }, // U+0046 'F'
+  {   907,  2,  3, 13, 14 }, // U+0047 'G'
+  {   935,  1,  3, 14, 14 }, // U+0048 'H'
+  {   963,  3,  3, 10, 14 }, // U+0049 'I'
+  {   991,  2,  3, 13, 14 }, // U+004A 'J'
+  {  1019,  1,  3, 15, 14 }, // U+004B 'K'
+  {  1047,  1,  3, 13, 14 }, // U+004C 'L'
+  {  1075,  0,  3, 16, 14 }, // U+004D 'M'
+  {  1103,  1,  3, 14, 14 }, // U+004E 'N'
+  {  1131,  2,  3, 12, 14 }, // U+004F 'O'
+  {  1159,  2,  3, 12, 14 }, // U+0050 'P'
+  {  1187,  2,  3, 12, 17 }, // U+0051 'Q'
+  {  1221,  1,  3, 14, 14 }, // U+0052 'R'
+  {  1249,  3,  3, 10, 14 }, // U+0053 'S'
+  {  1277,  2,  3, 12, 14 }, // U+0054 'T'
+  {  1305,  1,  3, 14, 14 }, // U+0055 'U'
+  {  1333,  1,  3, 15, 14 }, // U+0056 'V'
+  {  1361,  0,  3, 17, 14 }, // U+0057 'W'
+  {  1403,  1,  3, 14, 14 }, // U+0058 'X'
+  {  1431,  1,  3, 14, 14 }, // U+0059 'Y'
+  {  1459,  2,  3, 11, 14 }, // U+005A 'Z'
+  {  1487,  7,  2,  5, 18 }, // U+005B '['
+  {  1505,  3,  0, 10, 20 }, // U+005C
+  {  1545,  4,  2,  5, 18 }, // U+005D ']'
+  {  1563,  3,  1, 11,  8 }, // U+005E '^'
+  {  1579,  0, 22, 16,  2 }, // U+005F '_'
+  {  1583,  6,  1,  5,  4 }, // U+0060 '`'
+  {  1587,  2,  6, 12, 11 }, // U+0061 'a'
+  {  1609,  1,  2, 13, 15 }, // U+0062 'b'
+  {  1639,  2,  6, 12, 11 }, // U+0063 'c'
+  {  1661,  2,  2, 13, 15 }, // U+0064 'd'
+  {  1691,  2,  6, 12, 11 }, // U+0065 'e'
+  {  1713,  2,  2, 12, 15 }, // U+0066 'f'
+  {  1743,  2,  6, 13, 16 }, // U+0067 'g'
+  {  1775,  1,  2, 14, 15 }, // U+0068 'h'
+  {  1805,  2,  2, 12, 15 }, // U+0069 'i'
+  {  1835,  3,  2,  9, 20 }, // U+006A 'j'
+  {  1875,  2,  2, 12, 15 }, // U+006B 'k'
+  {  1905,  2,  2, 12, 15 }, // U+006C 'l'
+  {  1935,  0,  6, 16, 11 }, // U+006D 'm'
+  {  1957,  1,  6, 14, 11 }, // U+006E 'n'
+  {  1979,  2,  6, 12, 11 }, // U+006F 'o'
+  {  2001,  1,  6, 13, 16 }, // U+0070 'p'
+  {  2033,  2,  6, 13, 16 }, // U+0071 'q'
+  {  2065,  2,  6, 12, 11 }, // U+0072 'r'
+  {  2087,  3,  6, 10, 11 }, // U+0073 's'
+  {  2109,  2,  2, 12, 15 }, // U+0074 't'
+  {  2139,  1,  6, 14, 11 }, // U+0075 'u'
+  {  2161,  1,  6, 14, 11 }, // U+0076 'v'
+  {  2183,  1,  6, 13, 11 }, // U+0077 'w'
+  {  2205,  2,  6, 12, 11 }, // U+0078 'x'
+  {  2227,  1,  6, 15, 16 }, // U+0079 'y'
+  {  2259,  3,  6, 10, 11 }, // U+007A 'z'
+  {  2281,  5,  2,  6, 18 }, // U+007B '{'
+  {  2299,  7,  2,  2, 18 }, // U+007C '|'
+  {  2317,  5,  2,  6, 18 }, // U+007D '}'
+  {  2335,  2,  8, 11,  5 }, // U+007E '~'
+  };
+
+static const uint8_t Font24_Data[] = 
+  {
+  0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x40, 0x40, 0x00,
+  0x00, 0xe0, 0xe0, 0xe7, 0xe7, 0xe7, 0x42, 0x42, 0x42, 0x42, 0x19, 0x80,
+  0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0x19, 0x80, 0xff, 0xe0, 0xff, 0xe0,
+  0x19, 0x80, 0x33, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0x33, 0x00, 0x33, 0x00,
+  0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3d, 0x80,
+  0x7f, 0x80, 0xc3, 0x80, 0xc3, 0x80, 0xe0, 0x00, 0x7c, 0x00, 0x3f, 0x00,
+  0x07, 0x80, 0xc1, 0x80, 0xe1, 0x80, 0xe3, 0x80, 0xff, 0x00, 0xde, 0x00,
+  0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x3c, 0x00, 0x7e, 0x00,
+  0xe7, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xe7, 0x00, 0x7f, 0xc0, 0x3f, 0x00,
+  0xff, 0x80, 0x39, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x39, 0xc0, 0x1f, 0x80,
+  0x0f, 0x00, 0x1f, 0x80, 0x3f, 0x80, 0x63, 0x00, 0x60, 0x00, 0x60, 0x00,
+  0x30, 0x00, 0x38, 0x00, 0x7c, 0xe0, 0xef, 0xe0, 0xc7, 0x80, 0xc3, 0x80,
+  0x7f, 0xe0, 0x3e, 0xe0, 0xe0, 0xe0, 0xe0, 0x40, 0x40, 0x40, 0x40, 0x0c,
+  0x1c, 0x38, 0x78, 0x70, 0x70, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x70,
+  0x70, 0x38, 0x38, 0x1c, 0x0c, 0xc0, 0xe0, 0x70, 0x70, 0x38, 0x38, 0x1c,
+  0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x38, 0x38, 0x78, 0x70, 0xe0, 0xc0, 0x0c,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0xed, 0xc0, 0xff, 0xc0, 0x3f, 0x00, 0x1e,
+  0x00, 0x1e, 0x00, 0x33, 0x00, 0x33, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+  0x00, 0x06, 0x00, 0x06, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x06, 0x00, 0x06,
+  0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x38, 0x30, 0x70, 0x60, 0x60,
+  0xc0, 0xc0, 0xff, 0xc0, 0xff, 0xc0, 0xf0, 0xf0, 0xf0, 0x00, 0xc0, 0x00,
+  0xc0, 0x01, 0xc0, 0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x06,
+  0x00, 0x06, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30,
+  0x00, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00, 0xe0, 0x00, 0xc0, 0x00, 0xc0,
+  0x00, 0x1e, 0x00, 0x3f, 0x00, 0x61, 0x80, 0x61, 0x80, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x61,
+  0x80, 0x61, 0x80, 0x3f, 0x00, 0x1e, 0x00, 0x04, 0x00, 0x3c, 0x00, 0xfc,
+  0x00, 0xec, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0xff, 0xc0, 0xff,
+  0xc0, 0x1f, 0x00, 0x7f, 0xc0, 0xe0, 0xc0, 0xc0, 0x60, 0xc0, 0x60, 0x00,
+  0x60, 0x00, 0xc0, 0x01, 0x80, 0x07, 0x00, 0x0e, 0x00, 0x18, 0x00, 0x30,
+  0x00, 0x60, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0x1e, 0x00, 0x7f, 0x00, 0x63,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x03,
+  0x80, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xc1, 0xc0, 0xff, 0x80, 0x7e,
+  0x00, 0x03, 0x80, 0x07, 0x80, 0x07, 0x80, 0x0d, 0x80, 0x19, 0x80, 0x19,
+  0x80, 0x31, 0x80, 0x31, 0x80, 0x61, 0x80, 0xc1, 0x80, 0xff, 0xe0, 0xff,
+  0xe0, 0x01, 0x80, 0x0f, 0xe0, 0x0f, 0xe0, 0x7f, 0xc0, 0x7f, 0xc0, 0x60,
+  0x00, 0x60, 0x00, 0x60, 0x00, 0x6f, 0x00, 0x7f, 0xc0, 0x70, 0xc0, 0x00,
+  0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0xc0, 0xc0, 0xff, 0xc0, 0x3f,
+  0x00, 0x07, 0xc0, 0x1f, 0xc0, 0x38, 0x00, 0x70, 0x00, 0x60, 0x00, 0xc0,
+  0x00, 0xde, 0x00, 0xff, 0x80, 0xe1, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0x61, 0xc0, 0x7f, 0x80, 0x1f, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0xc0,
+  0xc0, 0xc1, 0xc0, 0x01, 0x80, 0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x03,
+  0x00, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x0c,
+  0x00, 0x3f, 0x00, 0x7f, 0x80, 0xe1, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x61,
+  0x80, 0x3f, 0x00, 0x3f, 0x00, 0x61, 0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xe1, 0xc0, 0x7f, 0x80, 0x3f, 0x00, 0x3e, 0x00, 0x7f, 0x80, 0xe1,
+  0x80, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0x61, 0xc0, 0x7f, 0xc0, 0x1e,
+  0xc0, 0x00, 0xc0, 0x01, 0x80, 0x03, 0x80, 0x07, 0x00, 0xfe, 0x00, 0xf8,
+  0x00, 0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf0, 0xf0,
+  0x3c, 0x3c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x38, 0x70, 0x60, 0x60, 0xc0,
+  0x80, 0x00, 0x1c, 0x00, 0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0x00, 0x3c,
+  0x00, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x03, 0xc0, 0x00, 0xf0, 0x00,
+  0x3c, 0x00, 0x1c, 0xff, 0xf8, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff,
+  0xf8, 0xff, 0xf8, 0xe0, 0x00, 0xf0, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x03,
+  0xc0, 0x00, 0xf0, 0x00, 0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x0f, 0x00, 0x3c,
+  0x00, 0xf0, 0x00, 0xe0, 0x00, 0x3e, 0x00, 0x7f, 0x00, 0xc3, 0x80, 0xc1,
+  0x80, 0xc1, 0x80, 0x03, 0x80, 0x07, 0x00, 0x1e, 0x00, 0x1c, 0x00, 0x18,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1f, 0x00, 0x3f,
+  0x80, 0x71, 0xc0, 0x60, 0xc0, 0xc3, 0xc0, 0xc7, 0xc0, 0xce, 0xc0, 0xcc,
+  0xc0, 0xcc, 0xc0, 0xcc, 0xc0, 0xc7, 0xc0, 0xc3, 0xc0, 0xc0, 0x00, 0x60,
+  0x00, 0x70, 0xc0, 0x3f, 0xc0, 0x1f, 0x00, 0x1f, 0x80, 0x1f, 0xc0, 0x01,
+  0xc0, 0x03, 0x60, 0x03, 0x60, 0x06, 0x30, 0x06, 0x30, 0x0c, 0x30, 0x0f,
+  0xf8, 0x1f, 0xf8, 0x18, 0x0c, 0x30, 0x0c, 0xfc, 0x7f, 0xfc, 0x7f, 0xff,
+  0xc0, 0xff, 0xe0, 0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0x3f,
+  0xe0, 0x3f, 0xf0, 0x30, 0x38, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0xff,
+  0xf0, 0xff, 0xe0, 0x0f, 0xb0, 0x3f, 0xf0, 0x70, 0x70, 0x60, 0x30, 0xc0,
+  0x30, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0x60,
+  0x30, 0x70, 0x70, 0x3f, 0xe0, 0x0f, 0xc0, 0xff, 0x80, 0xff, 0xe0, 0x30,
+  0x70, 0x30, 0x30, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30,
+  0x18, 0x30, 0x18, 0x30, 0x30, 0x30, 0x70, 0xff, 0xe0, 0xff, 0xc0, 0xff,
+  0xf0, 0xff, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x33, 0x30, 0x33, 0x00, 0x3f,
+  0x00, 0x3f, 0x00, 0x33, 0x00, 0x33, 0x30, 0x30, 0x30, 0x30, 0x30, 0xff,
+  0xf0, 0xff, 0xf0, 0xff, 0xf0, 0xff, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x33,
+  0x30, 0x33, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x33, 0x00, 0x33, 0x00, 0x30,
+  0x00, 0x30, 0x00, 0xff, 0x00, 0xff, 0x00, 0x0f, 0xb0, 0x3f, 0xf0, 0x70,
+  0x70, 0x60, 0x30, 0xc0, 0x30, 0xc0, 0x00, 0xc0, 0x00, 0xc3, 0xf8, 0xc3,
+  0xf8, 0xc0, 0x30, 0xe0, 0x30, 0x70, 0x70, 0x3f, 0xf0, 0x0f, 0xc0, 0xfc,
+  0xfc, 0xfc, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3f,
+  0xf0, 0x3f, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc,
+  0xfc, 0xfc, 0xfc, 0xff, 0xc0, 0xff, 0xc0, 0x0c, 0x00, 0x0c, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x1f, 0xf8, 0x1f, 0xf8, 0x00,
+  0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc1, 0x80, 0xff, 0x80, 0x3e, 0x00, 0xfe,
+  0x7c, 0xfe, 0x7c, 0x30, 0x60, 0x30, 0xc0, 0x31, 0x80, 0x33, 0x00, 0x37,
+  0x00, 0x3f, 0x80, 0x39, 0xc0, 0x30, 0xe0, 0x30, 0x60, 0x30, 0x70, 0xfe,
+  0x3e, 0xfe, 0x3e, 0xff, 0x00, 0xff, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,
+  0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0x18, 0x18, 0xff, 0xf8, 0xff, 0xf8, 0xf0, 0x0f, 0xf8, 0x1f, 0x38,
+  0x1c, 0x3c, 0x3c, 0x3c, 0x3c, 0x36, 0x6c, 0x36, 0x6c, 0x33, 0xcc, 0x33,
+  0xcc, 0x31, 0x8c, 0x30, 0x0c, 0x30, 0x0c, 0xfe, 0x7f, 0xfe, 0x7f, 0xf1,
+  0xfc, 0xf1, 0xfc, 0x38, 0x30, 0x3c, 0x30, 0x3e, 0x30, 0x36, 0x30, 0x37,
+  0x30, 0x33, 0xb0, 0x31, 0xb0, 0x31, 0xf0, 0x30, 0xf0, 0x30, 0x70, 0xfe,
+  0x30, 0xfe, 0x30, 0x0f, 0x00, 0x3f, 0xc0, 0x70, 0xe0, 0x60, 0x60, 0xe0,
+  0x70, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xc0, 0x30, 0xe0, 0x70, 0x60,
+  0x60, 0x70, 0xe0, 0x3f, 0xc0, 0x0f, 0x00, 0xff, 0xc0, 0xff, 0xe0, 0x30,
+  0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x60, 0x3f, 0xe0, 0x3f,
+  0x80, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0x00, 0xff, 0x00, 0x0f,
+  0x00, 0x3f, 0xc0, 0x70, 0xe0, 0x60, 0x60, 0xe0, 0x70, 0xc0, 0x30, 0xc0,
+  0x30, 0xc0, 0x30, 0xc0, 0x30, 0xe0, 0x70, 0x60, 0x60, 0x70, 0xe0, 0x3f,
+  0xc0, 0x1f, 0x00, 0x1f, 0x30, 0x3f, 0xf0, 0x30, 0xe0, 0xff, 0xc0, 0xff,
+  0xe0, 0x30, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0x3f, 0xe0, 0x3f,
+  0x80, 0x31, 0xc0, 0x30, 0xe0, 0x30, 0x60, 0x30, 0x70, 0xfe, 0x3c, 0xfe,
+  0x1c, 0x3e, 0xc0, 0x7f, 0xc0, 0xe1, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xf0,
+  0x00, 0x7e, 0x00, 0x1f, 0x80, 0x03, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe1,
+  0xc0, 0xff, 0x80, 0xdf, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0xc6, 0x30, 0xc6,
+  0x30, 0xc6, 0x30, 0xc6, 0x30, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+  0x00, 0x06, 0x00, 0x06, 0x00, 0x3f, 0xc0, 0x3f, 0xc0, 0xfc, 0xfc, 0xfc,
+  0xfc, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x60, 0x1f, 0xe0, 0x07,
+  0x80, 0xfe, 0xfe, 0xfe, 0xfe, 0x30, 0x18, 0x18, 0x30, 0x18, 0x30, 0x18,
+  0x30, 0x0c, 0x60, 0x0c, 0x60, 0x06, 0xc0, 0x06, 0xc0, 0x06, 0xc0, 0x03,
+  0x80, 0x03, 0x80, 0x01, 0x00, 0xfe, 0x3f, 0x80, 0xfe, 0x3f, 0x80, 0x30,
+  0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x86, 0x00, 0x19, 0xcc, 0x00, 0x19,
+  0xcc, 0x00, 0x1b, 0x6c, 0x00, 0x1b, 0x6c, 0x00, 0x1e, 0x7c, 0x00, 0x0e,
+  0x38, 0x00, 0x0e, 0x38, 0x00, 0x0c, 0x18, 0x00, 0x0c, 0x18, 0x00, 0xfc,
+  0xfc, 0xfc, 0xfc, 0x30, 0x30, 0x18, 0x60, 0x0c, 0xc0, 0x07, 0x80, 0x03,
+  0x00, 0x03, 0x00, 0x07, 0x80, 0x0c, 0xc0, 0x18, 0x60, 0x30, 0x30, 0xfc,
+  0xfc, 0xfc, 0xfc, 0xf8, 0xfc, 0xf8, 0xfc, 0x30, 0x30, 0x18, 0x60, 0x0c,
+  0xc0, 0x0c, 0xc0, 0x07, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+  0x00, 0x03, 0x00, 0x1f, 0xe0, 0x1f, 0xe0, 0x7f, 0xe0, 0x7f, 0xe0, 0x60,
+  0x60, 0x60, 0xc0, 0x61, 0x80, 0x63, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x18,
+  0x60, 0x30, 0x60, 0x60, 0x60, 0xc0, 0x60, 0xff, 0xe0, 0xff, 0xe0, 0xf8,
+  0xf8, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xf8, 0xf8, 0xc0, 0x00, 0xc0, 0x00, 0xe0, 0x00, 0x60,
+  0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+  0x80, 0x01, 0x80, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xc0, 0xf8, 0xf8, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+  0x18, 0xf8, 0xf8, 0x04, 0x00, 0x0e, 0x00, 0x1f, 0x00, 0x3b, 0x80, 0x31,
+  0x80, 0x60, 0xc0, 0xc0, 0x60, 0x80, 0x20, 0xff, 0xff, 0xff, 0xff, 0xc0,
+  0xe0, 0x38, 0x18, 0x3f, 0x00, 0x7f, 0x80, 0x00, 0xc0, 0x00, 0xc0, 0x1f,
+  0xc0, 0x7f, 0xc0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc1, 0xc0, 0x7f, 0xf0, 0x3e,
+  0xf0, 0xf0, 0x00, 0xf0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37, 0xc0, 0x3f,
+  0xf0, 0x38, 0x30, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30,
+  0x18, 0x38, 0x30, 0xff, 0xf0, 0xf7, 0xc0, 0x0f, 0xb0, 0x3f, 0xf0, 0x70,
+  0x70, 0xe0, 0x30, 0xc0, 0x30, 0xc0, 0x00, 0xc0, 0x00, 0xe0, 0x30, 0x70,
+  0x70, 0x3f, 0xe0, 0x0f, 0xc0, 0x01, 0xe0, 0x01, 0xe0, 0x00, 0x60, 0x00,
+  0x60, 0x1f, 0x60, 0x7f, 0xe0, 0x60, 0xe0, 0xc0, 0x60, 0xc0, 0x60, 0xc0,
+  0x60, 0xc0, 0x60, 0xc0, 0x60, 0x60, 0xe0, 0x7f, 0xf8, 0x1f, 0x78, 0x1f,
+  0x80, 0x7f, 0xe0, 0x60, 0x60, 0xc0, 0x30, 0xff, 0xf0, 0xff, 0xf0, 0xc0,
+  0x00, 0xc0, 0x00, 0x60, 0x30, 0x7f, 0xf0, 0x1f, 0xc0, 0x07, 0xf0, 0x0f,
+  0xf0, 0x18, 0x00, 0x18, 0x00, 0xff, 0xe0, 0xff, 0xe0, 0x18, 0x00, 0x18,
+  0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xff,
+  0xc0, 0xff, 0xc0, 0x1f, 0x78, 0x7f, 0xf8, 0x60, 0xe0, 0xc0, 0x60, 0xc0,
+  0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0x60, 0xe0, 0x7f, 0xe0, 0x1f,
+  0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xe0, 0x3f, 0xc0, 0x3f, 0x00, 0xf0,
+  0x00, 0xf0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x37, 0xc0, 0x3f, 0xe0, 0x38,
+  0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0xfc, 0xfc, 0xfc, 0xfc, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7e, 0x00, 0x7e, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+  0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xff, 0xf0, 0xff, 0xf0, 0x06,
+  0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0xff, 0x80, 0x01,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+  0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x80, 0xff,
+  0x00, 0xfc, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0x30, 0x00, 0x30, 0x00, 0x33,
+  0xe0, 0x33, 0xe0, 0x33, 0x00, 0x36, 0x00, 0x3e, 0x00, 0x3c, 0x00, 0x3e,
+  0x00, 0x37, 0x00, 0x33, 0x80, 0xf1, 0xf0, 0xf1, 0xf0, 0x7e, 0x00, 0x7e,
+  0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,
+  0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xff,
+  0xf0, 0xff, 0xf0, 0xf7, 0x78, 0xff, 0xfc, 0x39, 0xcc, 0x31, 0x8c, 0x31,
+  0x8c, 0x31, 0x8c, 0x31, 0x8c, 0x31, 0x8c, 0x31, 0x8c, 0xfd, 0xef, 0xfd,
+  0xef, 0xf7, 0xc0, 0xff, 0xe0, 0x38, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xfc, 0xfc, 0xfc, 0xfc, 0x0f,
+  0x00, 0x3f, 0xc0, 0x70, 0xe0, 0xe0, 0x70, 0xc0, 0x30, 0xc0, 0x30, 0xc0,
+  0x30, 0xe0, 0x70, 0x70, 0xe0, 0x3f, 0xc0, 0x0f, 0x00, 0xf7, 0xc0, 0xff,
+  0xf0, 0x38, 0x30, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30,
+  0x18, 0x38, 0x30, 0x3f, 0xf0, 0x37, 0xc0, 0x30, 0x00, 0x30, 0x00, 0x30,
+  0x00, 0xfe, 0x00, 0xfe, 0x00, 0x1f, 0x78, 0x7f, 0xf8, 0x60, 0xe0, 0xc0,
+  0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0xc0, 0x60, 0x60, 0xe0, 0x7f,
+  0xe0, 0x1f, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x03, 0xf8, 0x03,
+  0xf8, 0xf9, 0xe0, 0xfb, 0xf0, 0x1f, 0x30, 0x1c, 0x00, 0x18, 0x00, 0x18,
+  0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x3f,
+  0xc0, 0x7f, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xfc, 0x00, 0x7f, 0x80, 0x07,
+  0xc0, 0xc0, 0xc0, 0xc1, 0xc0, 0xff, 0x80, 0xff, 0x00, 0x30, 0x00, 0x30,
+  0x00, 0x30, 0x00, 0x30, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x30, 0x00, 0x30,
+  0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x70, 0x1f,
+  0xf0, 0x0f, 0xc0, 0xf0, 0xf0, 0xf0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0x1f, 0xfc, 0x0f,
+  0xbc, 0xf8, 0x7c, 0xf8, 0x7c, 0x30, 0x30, 0x30, 0x30, 0x18, 0x60, 0x18,
+  0x60, 0x0c, 0xc0, 0x0c, 0xc0, 0x0f, 0xc0, 0x07, 0x80, 0x07, 0x80, 0xf0,
+  0x78, 0xf0, 0x78, 0x62, 0x30, 0x67, 0x30, 0x67, 0x30, 0x35, 0x60, 0x3d,
+  0xe0, 0x3d, 0xe0, 0x38, 0xc0, 0x18, 0xc0, 0x18, 0xc0, 0xf9, 0xf0, 0xf9,
+  0xf0, 0x30, 0xc0, 0x19, 0x80, 0x0f, 0x00, 0x06, 0x00, 0x0f, 0x00, 0x19,
+  0x80, 0x30, 0xc0, 0xf9, 0xf0, 0xf9, 0xf0, 0xfc, 0x3e, 0xfc, 0x3e, 0x30,
+  0x18, 0x18, 0x30, 0x18, 0x30, 0x0c, 0x60, 0x0c, 0x60, 0x06, 0xc0, 0x07,
+  0xc0, 0x03, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x7f,
+  0x80, 0x7f, 0x80, 0xff, 0xc0, 0xff, 0xc0, 0xc1, 0x80, 0xc3, 0x00, 0x06,
+  0x00, 0x0c, 0x00, 0x18, 0x00, 0x30, 0xc0, 0x60, 0xc0, 0xff, 0xc0, 0xff,
+  0xc0, 0x1c, 0x3c, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0xe0, 0x70,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x3c, 0x1c, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0,
+  0xc0, 0xe0, 0xf0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1c, 0x38,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0xf0, 0xe0, 0x38, 0x00, 0x7c, 0x60, 0xee,
+  0xe0, 0xc7, 0xc0, 0x03, 0x80,
+  };
+
+const Atlas Font24_Atlas = 
+  {
+  127, Font24_Pages, Font24_Index, Font24_Glyphs, Font24_Data, ATLAS_BITS
+  };
+
+sFONT Font24 = { NULL, 17, 24, &Font24_Atlas };
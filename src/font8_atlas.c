@@ -0,0 +1,183 @@
+/*========================================================================
+  spi-oled
+  Glyph atlas for Font8, generated by tools/fontc from fonts/font8.c
+  Do not edit -- run 'make atlases' to regenerate
+========================================================================*/
+#include <stddef.h>
+#include <spi_oled/fonts.h>
+#include <spi_oled/atlas.h>
+
+static const uint16_t Font8_Pages[] = 
+  {
+  0,
+  };
+
+static const uint16_t Font8_Index[] = 
+  {
+  // U+0000
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+  65535, 65535, 0, 1, 2, 3, 4, 5, 6, 7,
+  8, 9, 10, 11, 12, 13, 14, 15, 16, 17,
+  18, 19, 20, 21, 22, 23, 24, 25, 26, 27,
+  28, 29, 30, 31, 32, 33, 34, 35, 36, 37,
+  38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+  48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+  58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+  68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+  78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+  88, 89, 90, 91, 92, 93, 94,
+  };
+
+static const AtlasGlyph Font8_Glyphs[] = 
+  {
+  {     0,  0,  0,  0,  0 }, // U+0020
+  {     0,  2,  0,  1,  6 }, // U+0021 '!'
+  {     6,  1,  0,  3,  2 }, // U+0022 '"'
+  {     8,  0,  0,  5,  7 }, // U+0023 '#'
+  {    15,  1,  0,  3,  7 }, // U+0024 '$'
+  {    22,  1,  0,  4,  6 }, // U+0025 '%'
+  {    28,  1,  1,  4,  5 }, // U+0026 '&'
+  {    33,  2,  0,  1,  3 }, // U+0027 '''
+  {    36,  2,  0,  2,  7 }, // U+0028 '('
+  {    43,  1,  0,  2,  7 }, // U+0029 ')'
+  {    50,  1,  0,  3,  4 }, // U+002A '*'
+  {    54,  0,  1,  5,  5 }, // U+002B '+'
+  {    59,  2,  4,  2,  3 }, // U+002C ','
+  {    62,  1,  3,  3,  1 }, // U+002D '-'
+  {    63,  2,  5,  1,  1 }, // U+002E '.'
+  {    64,  0,  0,  4,  7 }, // U+002F '/'
+  {    71,  1,  0,  3,  6 }, // U+0030 '0'
+  {    77,  0,  0,  5,  6 }, // U+0031 '1'
+  {    83,  1,  0,  3,  6 }, // U+0032 '2'
+  {    89,  1,  0,  3,  6 }, // U+0033 '3'
+  {    95,  1,  0,  4,  6 }, // U+0034 '4'
+  {   101,  1,  0,  3,  6 }, // U+0035 '5'
+  {   107,  1,  0,  3,  6 }, // U+0036 '6'
+  {   113,  1,  0,  3,  6 }, // U+0037 '7'
+  {   119,  1,  0,  3,  6 }, // U+0038 '8'
+  {   125,  1,  0,  3,  6 }, // U+0039 '9'
+  {   131,  2,  2,  1,  4 }, // U+003A ':'
+  {   135,  2,  2,  2,  4 }, // U+003B ';'
+  {   139,  0,  1,  4,  5 }, // U+003C '<'
+  {   144,  1,  1,  3,  3 }, // U+003D '='
+  {   147,  1,  1,  4,  5 }, // U+003E '>'
+  {   152,  1,  0,  3,  6 }, // U+003F '?'
+  {   158,  1,  0,  4,  7 }, // U+0040 '@'
+  {   165,  0,  0,  5,  6 }, // U+0041 'A'
+  {   171,  0,  0,  5,  6 }, // U+0042 'B'
+  {   177,  1,  0,  3,  6 }, // U+0043 'C'
+  {   183,  0,  0,  5,  6 }, // U+0044 'D'
+  {   189,  0,  0,  5,  6 }, // U+0045 'E'
+  {   195,  0,  0,  5,  6 }, // U+0046 'F'
+  {   201,  1,  0,  4,  6 }, // U+0047 'G'
+  {   207,  0,  0,  5,  6 }, // U+0048 'H'
+  {   213,  1,  0,  3,  6 }, // U+0049 'I'
+  {   219,  1,  0,  4,  6 }, // U+004A 'J'
+  {   225,  0,  0,  5,  6 }, // U+004B 'K'
+  {   231,  0,  0,  5,  6 }, // U+004C 'L'
+  {   237,  0,  0,  5,  6 }, // U+004D 'M'
+  {   243,  0,  0,  5,  6 }, // U+004E 'N'
+  {   249,  1,  0,  4,  6 }, // U+004F 'O'
+  {   255,  0,  0,  5,  6 }, // U+0050 'P'
+  {   261,  1,  0,  4,  7 }, // U+0051 'Q'
+  {   268,  0,  0,  5,  6 }, // U+0052 'R'
+  {   274,  1,  0,  3,  6 }, // U+0053 'S'
+  {   280,  0,  0,  5,  6 }, // U+0054 'T'
+  {   286,  0,  0,  5,  6 }, // U+0055 'U'
+  {   292,  0,  0,  5,  6 }, // U+0056 'V'
+  {   298,  0,  0,  5,  6 }, // U+0057 'W'
+  {   304,  0,  0,  5,  6 }, // U+0058 'X'
+  {   310,  0,  0,  5,  6 }, // U+0059 'Y'
+  {   316,  1,  0,  4,  6 }, // U+005A 'Z'
+  {   322,  2,  0,  2,  7 }, // U+005B '['
+  {   329,  0,  0,  4,  7 }, // U+005C
+  {   336,  1,  0,  2,  7 }, // U+005D ']'
+  {   343,  1,  0,  3,  3 }, // U+005E '^'
+  {   346,  0,  7,  5,  1 }, // U+005F '_'
+  {   347,  2,  0,  2,  2 }, // U+0060 '`'
+  {   349,  1,  2,  4,  4 }, // U+0061 'a'
+  {   353,  0,  0,  5,  6 }, // U+0062 'b'
+  {   359,  1,  2,  3,  4 }, // U+0063 'c'
+  {   363,  1,  0,  4,  6 }, // U+0064 'd'
+  {   369,  1,  2,  3,  4 }, // U+0065 'e'
+  {   373,  1,  0,  3,  6 }, // U+0066 'f'
+  {   379,  1,  2,  4,  6 }, // U+0067 'g'
+  {   385,  0,  0,  5,  6 }, // U+0068 'h'
+  {   391,  1,  0,  3,  6 }, // U+0069 'i'
+  {   397,  1,  0,  3,  8 }, // U+006A 'j'
+  {   405,  0,  0,  5,  6 }, // U+006B 'k'
+  {   411,  1,  0,  3,  6 }, // U+006C 'l'
+  {   417,  0,  2,  5,  4 }, // U+006D 'm'
+  {   421,  0,  2,  5,  4 }, // U+006E 'n'
+  {   425,  1,  2,  4,  4 }, // U+006F 'o'
+  {   429,  0,  2,  5,  6 }, // U+0070 'p'
+  {   435,  1,  2,  4,  6 }, // U+0071 'q'
+  {   441,  1,  2,  4,  4 }, // U+0072 'r'
+  {   445,  1,  2,  3,  4 }, // U+0073 's'
+  {   449,  0,  1,  5,  5 }, // U+0074 't'
+  {   454,  0,  2,  5,  4 }, // U+0075 'u'
+  {   458,  0,  2,  5,  4 }, // U+0076 'v'
+  {   462,  0,  2,  5,  4 }, // U+0077 'w'
+  {   466,  1,  2,  4,  4 }, // U+0078 'x'
+  {   470,  0,  2,  5,  6 }, // U+0079 'y'
+  {   476,  1,  2,  4,  4 }, // U+007A 'z'
+  {   480,  1,  0,  3,  7 }, // U+007B '{'
+  {   487,  2,  0,  1,  7 }, // U+007C '|'
+  {   494,  1,  0,  3,  7 }, // U+007D '}'
+  {   501,  1,  3,  4,  2 }, // U+007E '~'
+  };
+
+static const uint8_t Font8_Data[] = 
+  {
+  0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0xa0, 0xa0, 0x28, 0x50, 0xf8, 0x50,
+  0xf8, 0x50, 0xa0, 0x40, 0x60, 0xc0, 0x60, 0x20, 0xc0, 0x40, 0x40, 0x40,
+  0x30, 0xc0, 0x20, 0x20, 0x70, 0x40, 0xc0, 0xa0, 0xf0, 0x80, 0x80, 0x80,
+  0x40, 0x80, 0x80, 0x80, 0x80, 0x80, 0x40, 0x80, 0x40, 0x40, 0x40, 0x40,
+  0x40, 0x80, 0x40, 0xe0, 0x40, 0xa0, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x40,
+  0x80, 0x80, 0xe0, 0x80, 0x10, 0x20, 0x20, 0x20, 0x40, 0x40, 0x80, 0x40,
+  0xa0, 0xa0, 0xa0, 0xa0, 0x40, 0x60, 0x20, 0x20, 0x20, 0x20, 0xf8, 0x40,
+  0xa0, 0x40, 0x40, 0x80, 0xe0, 0x40, 0xa0, 0x20, 0x40, 0x20, 0xc0, 0x20,
+  0x60, 0xa0, 0xf0, 0x20, 0x70, 0xe0, 0x80, 0xc0, 0x20, 0xa0, 0x40, 0x60,
+  0x80, 0xc0, 0xa0, 0xa0, 0xc0, 0xe0, 0xa0, 0x20, 0x40, 0x40, 0x40, 0x40,
+  0xa0, 0x40, 0xa0, 0xa0, 0x40, 0x60, 0xa0, 0xa0, 0x60, 0x20, 0xc0, 0x80,
+  0x00, 0x00, 0x80, 0x40, 0x00, 0x40, 0x80, 0x10, 0x20, 0xc0, 0x20, 0x10,
+  0xe0, 0x00, 0xe0, 0x80, 0x40, 0x30, 0x40, 0x80, 0x40, 0xa0, 0x20, 0x40,
+  0x00, 0x40, 0x60, 0x90, 0x90, 0xb0, 0x90, 0x80, 0x70, 0x60, 0x20, 0x50,
+  0x70, 0x88, 0xd8, 0xf0, 0x48, 0x70, 0x48, 0x48, 0xf0, 0xe0, 0xa0, 0x80,
+  0x80, 0x80, 0x60, 0xf0, 0x48, 0x48, 0x48, 0x48, 0xf0, 0xf8, 0x48, 0x60,
+  0x40, 0x48, 0xf8, 0xf8, 0x48, 0x60, 0x40, 0x40, 0xe0, 0xe0, 0x80, 0x80,
+  0xb0, 0xa0, 0x60, 0xe8, 0x48, 0x78, 0x48, 0x48, 0xe8, 0xe0, 0x40, 0x40,
+  0x40, 0x40, 0xe0, 0x70, 0x20, 0x20, 0xa0, 0xa0, 0x40, 0xd8, 0x50, 0x60,
+  0x70, 0x50, 0xd8, 0xe0, 0x40, 0x40, 0x40, 0x48, 0xf8, 0xd8, 0xd8, 0xd8,
+  0xa8, 0x88, 0xd8, 0xd8, 0x68, 0x68, 0x58, 0x58, 0xe8, 0x60, 0x90, 0x90,
+  0x90, 0x90, 0x60, 0xf0, 0x48, 0x48, 0x70, 0x40, 0xe0, 0x60, 0x90, 0x90,
+  0x90, 0x90, 0x60, 0x30, 0xf0, 0x48, 0x48, 0x70, 0x48, 0xe8, 0xe0, 0xa0,
+  0x40, 0x20, 0xa0, 0xe0, 0xf8, 0xa8, 0x20, 0x20, 0x20, 0x70, 0xd8, 0x48,
+  0x48, 0x48, 0x48, 0x30, 0xd8, 0x88, 0x48, 0x50, 0x50, 0x30, 0xd8, 0x88,
+  0xa8, 0xa8, 0xa8, 0x50, 0xd8, 0x50, 0x20, 0x20, 0x50, 0xd8, 0xd8, 0x88,
+  0x50, 0x20, 0x20, 0x70, 0xf0, 0x90, 0x20, 0x40, 0x90, 0xf0, 0xc0, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0xc0, 0x80, 0x40, 0x40, 0x20, 0x20, 0x20, 0x10,
+  0xc0, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x40, 0x40, 0xa0, 0xf8, 0x80,
+  0x40, 0x60, 0x20, 0xe0, 0xf0, 0xc0, 0x40, 0x70, 0x48, 0x48, 0xf0, 0xe0,
+  0x80, 0x80, 0xe0, 0x30, 0x10, 0x70, 0x90, 0x90, 0x70, 0xe0, 0xe0, 0x80,
+  0x60, 0x20, 0x40, 0xe0, 0x40, 0x40, 0xe0, 0x70, 0x90, 0x90, 0x70, 0x10,
+  0x60, 0xc0, 0x40, 0x70, 0x48, 0x48, 0xe8, 0x40, 0x00, 0xc0, 0x40, 0x40,
+  0xe0, 0x40, 0x00, 0xe0, 0x20, 0x20, 0x20, 0x20, 0xe0, 0xc0, 0x40, 0x58,
+  0x70, 0x50, 0xd8, 0xc0, 0x40, 0x40, 0x40, 0x40, 0xe0, 0xd0, 0xa8, 0xa8,
+  0xa8, 0xf0, 0x48, 0x48, 0xc8, 0x60, 0x90, 0x90, 0x60, 0xf0, 0x48, 0x48,
+  0x70, 0x40, 0xe0, 0x70, 0x90, 0x90, 0x70, 0x10, 0x30, 0xf0, 0x40, 0x40,
+  0xe0, 0x60, 0x40, 0x20, 0xc0, 0x40, 0xf0, 0x40, 0x48, 0x30, 0xd8, 0x48,
+  0x48, 0x38, 0xc8, 0x48, 0x30, 0x30, 0xd8, 0xa8, 0xa8, 0x50, 0x90, 0x60,
+  0x60, 0x90, 0xd8, 0x50, 0x50, 0x20, 0x20, 0x60, 0xf0, 0xa0, 0x50, 0xf0,
+  0x20, 0x40, 0x40, 0xc0, 0x40, 0x40, 0x20, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x40, 0x40, 0x60, 0x40, 0x40, 0x80, 0x50, 0xa0,
+  };
+
+const Atlas Font8_Atlas = 
+  {
+  127, Font8_Pages, Font8_Index, Font8_Glyphs, Font8_Data, ATLAS_BITS
+  };
+
+sFONT Font8 = { NULL, 5, 8, &Font8_Atlas };
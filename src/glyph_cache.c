@@ -0,0 +1,132 @@
+/*========================================================================
+  spi-oled
+  glyph_cache.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  A cache of glyphs expanded from the 1bpp font tables into the 4bpp
+  frame buffer layout. Decoding a glyph bit by bit is done once; after 
+  that, drawing it is a masked write of whole bytes -- two pixels at a
+  time. The cache stores only a mask, not the coloured pixels, so one 
+  entry serves every colour
+========================================================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <spi_oled/glyph_cache.h>
+#include <spi_oled/debug.h>
+
+static Glyph glyph_cache[GLYPH_CACHE_SLOTS];
+
+static int glyph_cache_slot (const sFONT *font, char c, int phase)
+  {
+  uintptr_t h = (uintptr_t)font >> 4;
+  h = h * 31 + (unsigned char)c;
+  h = h * 2 + phase;
+  return h % GLYPH_CACHE_SLOTS;
+  }
+
+
+/* Expand the 1bpp glyph rows, which are padded to whole bytes, into
+ * nibble masks */
+static void glyph_expand (Glyph *g, const sFONT *font, char c, int phase)
+  {
+  int bytes_per_row = (font->Width + 7) / 8;
+  const uint8_t *src = &font->table[(c - ' ') * font->Height 
+    * bytes_per_row];
+  int row_bytes = (phase + font->Width + 1) / 2;
+  int size = row_bytes * font->Height;
+  if (size > g->capacity)
+    {
+    free (g->mask);
+    g->mask = malloc (size);
+    g->capacity = size;
+    }
+  memset (g->mask, 0, size);
+
+  for (int row = 0; row < font->Height; row++)
+    {
+    uint8_t *dst = g->mask + row * row_bytes;
+    for (int column = 0; column < font->Width; column++)
+      {
+      if (src[column / 8] & (0x80 >> (column % 8)))
+        {
+        int n = phase + column;
+        dst[n / 2] |= (n & 1) ? 0x0F : 0xF0;
+        }
+      }
+    src += bytes_per_row;
+    }
+
+  g->font = font;
+  g->c = c;
+  g->phase = phase;
+  g->row_bytes = row_bytes;
+  g->height = font->Height;
+  }
+
+
+const Glyph *glyph_cache_get (const sFONT *font, char c, int phase)
+  {
+  if (c < ' ' || c > '~') return NULL;
+  Glyph *g = &glyph_cache[glyph_cache_slot (font, c, phase)];
+  if (g->font != font || g->c != c || g->phase != phase)
+    glyph_expand (g, font, c, phase);
+  return g;
+  }
+
+
+void glyph_blit (const Glyph *glyph, uint8_t *buffer, int stride, 
+      int x, int y, int row1, int row2, uint8_t colour)
+  {
+  uint8_t fill = (colour & 0x0F) * 0x11;
+  const uint8_t *m = glyph->mask + row1 * glyph->row_bytes;
+  uint8_t *d = buffer + (y + row1) * stride + x / 2;
+  for (int row = row1; row < row2; row++)
+    {
+    for (int i = 0; i < glyph->row_bytes; i++)
+      d[i] = (d[i] & ~m[i]) | (fill & m[i]);
+    m += glyph->row_bytes;
+    d += stride;
+    }
+  }
+
+
+/* Every nibble in the glyph box is written -- fg where the mask is set,
+ * bg where it isn't. Only the first and last bytes of a row can be
+ * shared with pixels outside the box */
+void glyph_blit_opaque (const Glyph *glyph, uint8_t *buffer, int stride, 
+      int x, int y, int row1, int row2, uint8_t fg, uint8_t bg)
+  {
+  uint8_t f = (fg & 0x0F) * 0x11;
+  uint8_t b = (bg & 0x0F) * 0x11;
+  int n = glyph->row_bytes;
+  uint8_t first = glyph->phase ? 0x0F : 0xFF;
+  uint8_t last = (glyph->phase + glyph->font->Width) & 1 ? 0xF0 : 0xFF;
+  if (n == 1) first &= last;
+  const uint8_t *m = glyph->mask + row1 * n;
+  uint8_t *d = buffer + (y + row1) * stride + x / 2;
+  for (int row = row1; row < row2; row++)
+    {
+    d[0] = (d[0] & ~first) | (((f & m[0]) | (b & ~m[0])) & first);
+    for (int i = 1; i < n - 1; i++)
+      d[i] = (f & m[i]) | (b & ~m[i]);
+    if (n > 1)
+      d[n - 1] = (d[n - 1] & ~last) 
+        | (((f & m[n - 1]) | (b & ~m[n - 1])) & last);
+    m += n;
+    d += stride;
+    }
+  }
+
+
+void glyph_cache_clear (void)
+  {
+  debug_log ("Call glyph_cache_clear");
+  for (int i = 0; i < GLYPH_CACHE_SLOTS; i++)
+    {
+    free (glyph_cache[i].mask);
+    memset (&glyph_cache[i], 0, sizeof (Glyph));
+    }
+  }
+
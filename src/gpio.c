@@ -12,15 +12,20 @@
 #include <stdlib.h>
 #include <errno.h>
 #include <string.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
 #include <spi_oled/gpio.h>
 #include <spi_oled/debug.h>
 
+const char *gpio_sysfs_root = GPIO_SYSFS_ROOT;
+
 BOOL gpio_set_direction (int pin, GPIODirection direction)
   {
   debug_log ("Call gpio_set_direction: pin=%d, dir=%d", pin, direction);
   char path[512];
 
-  snprintf (path, sizeof (path), "/sys/class/gpio/gpio%d/direction", pin);
+  snprintf (path, sizeof (path), "%s/gpio%d/direction", 
+    gpio_sysfs_root, pin);
   int fd = open (path, O_WRONLY);
   if (fd < 0) 
     {
@@ -47,10 +52,12 @@ BOOL gpio_set_direction (int pin, GPIODirection direction)
 BOOL gpio_export (int pin)
   {
   debug_log ("Call gpio_export: pin=%d", pin);
-  int fd = open("/sys/class/gpio/export", O_WRONLY);
+  char path[512];
+  snprintf (path, sizeof (path), "%s/export", gpio_sysfs_root);
+  int fd = open (path, O_WRONLY);
   if (fd < 0) 
     {
-    debug_log ("Can't export GPIO pin %d: %s", strerror (errno));
+    debug_log ("Can't export GPIO pin %d: %s", pin, strerror (errno));
     return FALSE;
     }
 
@@ -70,7 +77,7 @@ BOOL gpio_set_pin (int pin, GPIOLevel level)
   debug_log ("Call gpio_set_pin: pin=%d, level=%d", pin, level);
   char path[512];
 
-  snprintf (path, sizeof (path), "/sys/class/gpio/gpio%d/value", pin);
+  snprintf (path, sizeof (path), "%s/gpio%d/value", gpio_sysfs_root, pin);
   int fd = open (path, O_WRONLY);
   if (fd < 0) 
     {
@@ -94,4 +101,180 @@ BOOL gpio_set_pin (int pin, GPIOLevel level)
   }
 
 
+GPIO *gpio_open (const int *pins, int n)
+  {
+  debug_log ("Call gpio_open: n=%d", n);
+  if (n > GPIO_MAX_LINES)
+    {
+    debug_log ("Too many GPIO lines: %d", n);
+    return NULL;
+    }
+
+  GPIO *self = malloc (sizeof (GPIO));
+  self->backend = GPIO_BACKEND_SYSFS;
+  self->req_fd = -1;
+  self->n = 0;
+  for (int i = 0; i < n; i++)
+    {
+    int pin = pins[i];
+    if (!gpio_export (pin) || !gpio_set_direction (pin, GPIO_OUT))
+      {
+      gpio_close (self);
+      return NULL;
+      }
+
+    char path[512];
+    snprintf (path, sizeof (path), "%s/gpio%d/value", gpio_sysfs_root, pin);
+    int fd = open (path, O_WRONLY);
+    if (fd < 0) 
+      {
+      debug_log ("can't open %s: %s", path, strerror (errno)); 
+      gpio_close (self);
+      return NULL;
+      }
+
+    self->pins[i] = pin;
+    self->fds[i] = fd;
+    self->levels[i] = -1;
+    self->n++;
+    }
+
+  return self;
+  }
+
+
+BOOL gpio_set (GPIO *self, int line, GPIOLevel level)
+  {
+  if (self->levels[line] == level) return TRUE;
+  if (self->backend == GPIO_BACKEND_CHARDEV)
+    return gpio_set_multi (self, 1U << line, level == GPIO_HIGH ? ~0U : 0);
+
+  const char *value = level == GPIO_HIGH ? "1" : "0";
+  if (pwrite (self->fds[line], value, 1, 0) != 1)
+    {
+    debug_log ("Can't set pin %d: %s", self->pins[line], strerror (errno));
+    self->levels[line] = -1;
+    return FALSE;
+    }
+
+  self->levels[line] = level;
+  return TRUE;
+  }
+
+
+GPIO *gpio_open_chip (const char *chip, const int *pins, int n)
+  {
+  debug_log ("Call gpio_open_chip: chip=%s, n=%d", chip, n);
+  if (n > GPIO_MAX_LINES)
+    {
+    debug_log ("Too many GPIO lines: %d", n);
+    return NULL;
+    }
+
+  int chip_fd = open (chip, O_RDONLY);
+  if (chip_fd < 0)
+    {
+    debug_log ("Can't open '%s': %s", chip, strerror (errno));
+    return NULL;
+    }
+
+  // Request all the lines as outputs, initially high. For the panel, 
+  //  that means CS deasserted and RST inactive
+  struct gpio_v2_line_request req;
+  memset (&req, 0, sizeof (req));
+  for (int i = 0; i < n; i++)
+    req.offsets[i] = pins[i];
+  req.num_lines = n;
+  strncpy (req.consumer, "spi_oled", sizeof (req.consumer) - 1);
+  req.config.flags = GPIO_V2_LINE_FLAG_OUTPUT;
+  req.config.num_attrs = 1;
+  req.config.attrs[0].attr.id = GPIO_V2_LINE_ATTR_ID_OUTPUT_VALUES;
+  req.config.attrs[0].attr.values = (1ULL << n) - 1;
+  req.config.attrs[0].mask = (1ULL << n) - 1;
+
+  int ret = ioctl (chip_fd, GPIO_V2_GET_LINE_IOCTL, &req);
+  close (chip_fd);
+  if (ret < 0)
+    {
+    debug_log ("Can't request lines from '%s': %s", chip, strerror (errno));
+    return NULL;
+    }
+
+  GPIO *self = malloc (sizeof (GPIO));
+  self->backend = GPIO_BACKEND_CHARDEV;
+  self->req_fd = req.fd;
+  self->n = n;
+  for (int i = 0; i < n; i++)
+    {
+    self->pins[i] = pins[i];
+    self->fds[i] = -1;
+    self->levels[i] = GPIO_HIGH;
+    }
+
+  debug_log ("Requested %d lines from %s", n, chip);
+  return self;
+  }
+
+
+BOOL gpio_set_multi (GPIO *self, uint32_t mask, uint32_t values)
+  {
+  // Drop the lines that are already at the requested level
+  for (int i = 0; i < self->n; i++)
+    {
+    if ((mask & (1U << i)) 
+         && self->levels[i] == ((values >> i) & 1 ? GPIO_HIGH : GPIO_LOW))
+      mask &= ~(1U << i);
+    }
+  if (mask == 0) return TRUE;
+
+  if (self->backend == GPIO_BACKEND_CHARDEV)
+    {
+    struct gpio_v2_line_values lv;
+    lv.mask = mask;
+    lv.bits = values & mask;
+    if (ioctl (self->req_fd, GPIO_V2_LINE_SET_VALUES_IOCTL, &lv) < 0)
+      {
+      debug_log ("Can't set line values: %s", strerror (errno));
+      for (int i = 0; i < self->n; i++)
+        if (mask & (1U << i)) self->levels[i] = -1;
+      return FALSE;
+      }
+    for (int i = 0; i < self->n; i++)
+      {
+      if (mask & (1U << i)) 
+        self->levels[i] = (values >> i) & 1 ? GPIO_HIGH : GPIO_LOW;
+      }
+    return TRUE;
+    }
+
+  BOOL ret = TRUE;
+  for (int i = 0; i < self->n; i++)
+    {
+    if (mask & (1U << i)) 
+      {
+      if (!gpio_set (self, i, (values >> i) & 1 ? GPIO_HIGH : GPIO_LOW))
+        ret = FALSE;
+      }
+    }
+  return ret;
+  }
+
+
+void gpio_close (GPIO *self)
+  {
+  debug_log ("Call gpio_close");
+  if (self)
+    {
+    if (self->backend == GPIO_BACKEND_CHARDEV)
+      close (self->req_fd);
+    else
+      {
+      for (int i = 0; i < self->n; i++)
+        close (self->fds[i]);
+      }
+    free (self);
+    }
+  else
+    debug_log ("self is null in gpio_close");
+  }
 
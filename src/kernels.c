@@ -0,0 +1,440 @@
+/*========================================================================
+  spi-oled
+  kernels.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Bulk buffer operations -- fill, rectangular fill, copy, and compare --
+  in plain C and in vectorized versions for NEON (Raspberry Pi), and
+  SSE2 and AVX2 (x86, for testing off the device). The vectorized
+  versions are only compiled where the compiler supports them, and the
+  AVX2 version is only used if the CPU supports it
+========================================================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <spi_oled/kernels.h>
+#include <spi_oled/debug.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(__SSE2__)
+#define KERNELS_SSE2
+#include <emmintrin.h>
+#endif
+#if defined(__GNUC__)
+#define KERNELS_AVX2
+#include <immintrin.h>
+#endif
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+/*========================================================================
+  Scalar reference kernels
+========================================================================*/
+
+static void scalar_fill (uint8_t *dst, uint8_t value, int n)
+  {
+  memset (dst, value, n);
+  }
+
+
+static void scalar_fill_rect (uint8_t *dst, int stride, int n, int rows,
+      uint8_t value)
+  {
+  for (int i = 0; i < rows; i++)
+    memset (dst + i * stride, value, n);
+  }
+
+
+static void scalar_copy (uint8_t *dst, const uint8_t *src, int n)
+  {
+  memcpy (dst, src, n);
+  }
+
+
+/* Compare eight bytes at a time, and only examine the words that differ
+ * byte by byte */
+static BOOL scalar_diff (const uint8_t *a, const uint8_t *b, int n,
+      int *first, int *last)
+  {
+  int i = 0;
+  while (i + 8 <= n)
+    {
+    uint64_t wa, wb;
+    memcpy (&wa, a + i, 8);
+    memcpy (&wb, b + i, 8);
+    if (wa != wb) break;
+    i += 8;
+    }
+  while (i < n && a[i] == b[i]) i++;
+  if (i == n) return FALSE;
+  *first = i;
+
+  int j = n;
+  while (j - 8 > i)
+    {
+    uint64_t wa, wb;
+    memcpy (&wa, a + j - 8, 8);
+    memcpy (&wb, b + j - 8, 8);
+    if (wa != wb) break;
+    j -= 8;
+    }
+  while (a[j - 1] == b[j - 1]) j--;
+  *last = j;
+  return TRUE;
+  }
+
+const Kernels kernels_scalar =
+  {
+  "scalar", scalar_fill, scalar_fill_rect, scalar_copy, scalar_diff
+  };
+
+/*========================================================================
+  SSE2 kernels
+========================================================================*/
+#ifdef KERNELS_SSE2
+
+static void sse2_fill (uint8_t *dst, uint8_t value, int n)
+  {
+  __m128i v = _mm_set1_epi8 ((char)value);
+  int i = 0;
+  for (; i + 16 <= n; i += 16)
+    _mm_storeu_si128 ((__m128i *)(dst + i), v);
+  for (; i < n; i++)
+    dst[i] = value;
+  }
+
+
+static void sse2_fill_rect (uint8_t *dst, int stride, int n, int rows,
+      uint8_t value)
+  {
+  for (int i = 0; i < rows; i++)
+    sse2_fill (dst + i * stride, value, n);
+  }
+
+
+static void sse2_copy (uint8_t *dst, const uint8_t *src, int n)
+  {
+  int i = 0;
+  for (; i + 16 <= n; i += 16)
+    _mm_storeu_si128 ((__m128i *)(dst + i),
+      _mm_loadu_si128 ((const __m128i *)(src + i)));
+  for (; i < n; i++)
+    dst[i] = src[i];
+  }
+
+
+/* movemask() gives one bit per byte, set where the bytes are equal, so
+ * the lowest clear bit is the first difference in a block, and the
+ * highest clear bit is the last */
+static BOOL sse2_diff (const uint8_t *a, const uint8_t *b, int n,
+      int *first, int *last)
+  {
+  int i = 0;
+  for (; i + 16 <= n; i += 16)
+    {
+    unsigned m = ~_mm_movemask_epi8 (_mm_cmpeq_epi8 (
+      _mm_loadu_si128 ((const __m128i *)(a + i)),
+      _mm_loadu_si128 ((const __m128i *)(b + i)))) & 0xFFFF;
+    if (m)
+      {
+      i += __builtin_ctz (m);
+      break;
+      }
+    }
+  while (i < n && a[i] == b[i]) i++;
+  if (i == n) return FALSE;
+  *first = i;
+
+  int j = n;
+  for (; j - 16 >= i; j -= 16)
+    {
+    unsigned m = ~_mm_movemask_epi8 (_mm_cmpeq_epi8 (
+      _mm_loadu_si128 ((const __m128i *)(a + j - 16)),
+      _mm_loadu_si128 ((const __m128i *)(b + j - 16)))) & 0xFFFF;
+    if (m)
+      {
+      j = j - 16 + 32 - __builtin_clz (m);
+      break;
+      }
+    }
+  while (a[j - 1] == b[j - 1]) j--;
+  *last = j;
+  return TRUE;
+  }
+
+static const Kernels kernels_sse2 =
+  {
+  "sse2", sse2_fill, sse2_fill_rect, sse2_copy, sse2_diff
+  };
+
+#endif
+
+/*========================================================================
+  AVX2 kernels
+  These are compiled with the avx2 target attribute, so the rest of the
+  library does not need to be built for AVX2, and are only selected if
+  the CPU reports AVX2 support
+========================================================================*/
+#ifdef KERNELS_AVX2
+
+#define AVX2 __attribute__ ((target ("avx2")))
+
+AVX2 static void avx2_fill (uint8_t *dst, uint8_t value, int n)
+  {
+  __m256i v = _mm256_set1_epi8 ((char)value);
+  int i = 0;
+  for (; i + 32 <= n; i += 32)
+    _mm256_storeu_si256 ((__m256i *)(dst + i), v);
+  for (; i < n; i++)
+    dst[i] = value;
+  }
+
+
+AVX2 static void avx2_fill_rect (uint8_t *dst, int stride, int n, int rows,
+      uint8_t value)
+  {
+  for (int i = 0; i < rows; i++)
+    avx2_fill (dst + i * stride, value, n);
+  }
+
+
+AVX2 static void avx2_copy (uint8_t *dst, const uint8_t *src, int n)
+  {
+  int i = 0;
+  for (; i + 32 <= n; i += 32)
+    _mm256_storeu_si256 ((__m256i *)(dst + i),
+      _mm256_loadu_si256 ((const __m256i *)(src + i)));
+  for (; i < n; i++)
+    dst[i] = src[i];
+  }
+
+
+AVX2 static BOOL avx2_diff (const uint8_t *a, const uint8_t *b, int n,
+      int *first, int *last)
+  {
+  int i = 0;
+  for (; i + 32 <= n; i += 32)
+    {
+    unsigned m = ~(unsigned)_mm256_movemask_epi8 (_mm256_cmpeq_epi8 (
+      _mm256_loadu_si256 ((const __m256i *)(a + i)),
+      _mm256_loadu_si256 ((const __m256i *)(b + i))));
+    if (m)
+      {
+      i += __builtin_ctz (m);
+      break;
+      }
+    }
+  while (i < n && a[i] == b[i]) i++;
+  if (i == n) return FALSE;
+  *first = i;
+
+  int j = n;
+  for (; j - 32 >= i; j -= 32)
+    {
+    unsigned m = ~(unsigned)_mm256_movemask_epi8 (_mm256_cmpeq_epi8 (
+      _mm256_loadu_si256 ((const __m256i *)(a + j - 32)),
+      _mm256_loadu_si256 ((const __m256i *)(b + j - 32))));
+    if (m)
+      {
+      j = j - 32 + 32 - __builtin_clz (m);
+      break;
+      }
+    }
+  while (a[j - 1] == b[j - 1]) j--;
+  *last = j;
+  return TRUE;
+  }
+
+static const Kernels kernels_avx2 =
+  {
+  "avx2", avx2_fill, avx2_fill_rect, avx2_copy, avx2_diff
+  };
+
+#endif
+
+/*========================================================================
+  NEON kernels
+========================================================================*/
+#ifdef KERNELS_NEON
+
+static void neon_fill (uint8_t *dst, uint8_t value, int n)
+  {
+  uint8x16_t v = vdupq_n_u8 (value);
+  int i = 0;
+  for (; i + 16 <= n; i += 16)
+    vst1q_u8 (dst + i, v);
+  for (; i < n; i++)
+    dst[i] = value;
+  }
+
+
+static void neon_fill_rect (uint8_t *dst, int stride, int n, int rows,
+      uint8_t value)
+  {
+  for (int i = 0; i < rows; i++)
+    neon_fill (dst + i * stride, value, n);
+  }
+
+
+static void neon_copy (uint8_t *dst, const uint8_t *src, int n)
+  {
+  int i = 0;
+  for (; i + 16 <= n; i += 16)
+    vst1q_u8 (dst + i, vld1q_u8 (src + i));
+  for (; i < n; i++)
+    dst[i] = src[i];
+  }
+
+
+/* TRUE if the 16-byte blocks at a and b are identical. There's no
+ * movemask on NEON, so check that both halves of the comparison result
+ * are all ones */
+static inline BOOL neon_block_equal (const uint8_t *a, const uint8_t *b)
+  {
+  uint64x2_t eq = vreinterpretq_u64_u8 (vceqq_u8 (vld1q_u8 (a),
+    vld1q_u8 (b)));
+  return (vgetq_lane_u64 (eq, 0) & vgetq_lane_u64 (eq, 1)) == ~0ULL;
+  }
+
+
+static BOOL neon_diff (const uint8_t *a, const uint8_t *b, int n,
+      int *first, int *last)
+  {
+  int i = 0;
+  while (i + 16 <= n && neon_block_equal (a + i, b + i))
+    i += 16;
+  while (i < n && a[i] == b[i]) i++;
+  if (i == n) return FALSE;
+  *first = i;
+
+  int j = n;
+  while (j - 16 > i && neon_block_equal (a + j - 16, b + j - 16))
+    j -= 16;
+  while (a[j - 1] == b[j - 1]) j--;
+  *last = j;
+  return TRUE;
+  }
+
+static const Kernels kernels_neon =
+  {
+  "neon", neon_fill, neon_fill_rect, neon_copy, neon_diff
+  };
+
+#endif
+
+/*========================================================================
+  Selection and verification
+========================================================================*/
+
+static const Kernels *kernels_current = NULL;
+
+/* Simple LCG, so that verification is repeatable */
+static uint8_t kernels_random (uint32_t *seed)
+  {
+  *seed = *seed * 1103515245 + 12345;
+  return (uint8_t)(*seed >> 16);
+  }
+
+
+BOOL kernels_verify (const Kernels *k)
+  {
+  enum { SIZE = 512 };
+  uint8_t a[SIZE], b[SIZE], ra[SIZE], rb[SIZE];
+  uint32_t seed = 1;
+
+  for (int n = 0; n <= 130; n++)
+    {
+    for (int offset = 0; offset < 8; offset++)
+      {
+      for (int i = 0; i < SIZE; i++)
+        a[i] = ra[i] = b[i] = rb[i] = kernels_random (&seed);
+      uint8_t v = kernels_random (&seed);
+
+      k->fill (a + offset, v, n);
+      kernels_scalar.fill (ra + offset, v, n);
+      if (memcmp (a, ra, SIZE)) return FALSE;
+
+      k->fill_rect (a + offset, 67, n, 3, v ^ 0x5A);
+      kernels_scalar.fill_rect (ra + offset, 67, n, 3, v ^ 0x5A);
+      if (memcmp (a, ra, SIZE)) return FALSE;
+
+      k->copy (b + offset, a + 256, n);
+      kernels_scalar.copy (rb + offset, ra + 256, n);
+      if (memcmp (b, rb, SIZE)) return FALSE;
+
+      // Compare two equal buffers, then make up to three changes
+      for (int changes = 0; changes < 4; changes++)
+        {
+        if (changes > 0 && n > 0)
+          b[offset + kernels_random (&seed) % n] ^= 1 << (changes * 2);
+        int f = -1, l = -1, rf = -1, rl = -1;
+        BOOL d = k->diff (a + offset, b + offset, n, &f, &l);
+        BOOL rd = kernels_scalar.diff (a + offset, b + offset, n, &rf, &rl);
+        if (d != rd) return FALSE;
+        if (d && (f != rf || l != rl)) return FALSE;
+        }
+      }
+    }
+  return TRUE;
+  }
+
+
+int kernels_available (const Kernels **available)
+  {
+  int n = 0;
+#ifdef KERNELS_AVX2
+  __builtin_cpu_init ();
+  if (__builtin_cpu_supports ("avx2"))
+    available[n++] = &kernels_avx2;
+#endif
+#ifdef KERNELS_SSE2
+  available[n++] = &kernels_sse2;
+#endif
+#ifdef KERNELS_NEON
+  available[n++] = &kernels_neon;
+#endif
+  available[n++] = &kernels_scalar;
+  return n;
+  }
+
+
+/* Choose the best kernels that the compiler and CPU support, unless
+ * SPI_OLED_KERNELS names a particular set */
+static const Kernels *kernels_select (void)
+  {
+  const Kernels *available[KERNELS_MAX_SETS];
+  int n = kernels_available (available);
+  const Kernels *k = available[0];
+  const char *name = getenv ("SPI_OLED_KERNELS");
+  if (name)
+    {
+    for (int i = 0; i < n; i++)
+      if (strcmp (available[i]->name, name) == 0) k = available[i];
+    if (strcmp (k->name, name) != 0)
+      debug_log ("Kernels '%s' not available", name);
+    }
+
+  // Checking the kernels is cheap, but it's not something we need to do
+  //  on every run. 'make check' checks every set that is available
+  if (spi_oled_debug && k != &kernels_scalar && !kernels_verify (k))
+    {
+    debug_log ("Kernels '%s' failed verification", k->name);
+    k = &kernels_scalar;
+    }
+
+  debug_log ("Using %s kernels", k->name);
+  return k;
+  }
+
+
+const Kernels *kernels (void)
+  {
+  if (!kernels_current)
+    kernels_current = kernels_select ();
+  return kernels_current;
+  }
+
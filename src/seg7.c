@@ -0,0 +1,185 @@
+/*========================================================================
+  spi-oled
+  seg7.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  7-segment characters. Which segments make up each character is a 
+  table lookup, and the segments are rasterized into a mask only the 
+  first time a character is needed at a given size. After that, drawing
+  a digit is a masked copy of whole bytes
+========================================================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <spi_oled/seg7.h>
+#include <spi_oled/debug.h>
+
+/*
+ * Segments are numbered, and bit n-1 of a mask is segment n
+ *      1
+ *    2   3
+ *      4
+ *    5   7
+ *      6
+ */
+#define SEG(n) (1 << ((n) - 1))
+
+static const uint8_t seg7_digits[16] =
+  {
+  SEG(1) | SEG(2) | SEG(3) | SEG(5) | SEG(6) | SEG(7),          // 0
+  SEG(3) | SEG(7),                                              // 1
+  SEG(1) | SEG(3) | SEG(4) | SEG(5) | SEG(6),                   // 2
+  SEG(1) | SEG(3) | SEG(4) | SEG(6) | SEG(7),                   // 3
+  SEG(2) | SEG(3) | SEG(4) | SEG(7),                            // 4
+  SEG(1) | SEG(2) | SEG(4) | SEG(6) | SEG(7),                   // 5
+  SEG(1) | SEG(2) | SEG(4) | SEG(5) | SEG(6) | SEG(7),          // 6
+  SEG(1) | SEG(3) | SEG(7),                                     // 7
+  0x7F,                                                         // 8
+  SEG(1) | SEG(2) | SEG(3) | SEG(4) | SEG(6) | SEG(7),          // 9
+  SEG(1) | SEG(2) | SEG(3) | SEG(4) | SEG(5) | SEG(7),          // A
+  SEG(2) | SEG(4) | SEG(5) | SEG(6) | SEG(7),                   // b
+  SEG(1) | SEG(2) | SEG(5) | SEG(6),                            // C
+  SEG(3) | SEG(4) | SEG(5) | SEG(6) | SEG(7),                   // d
+  SEG(1) | SEG(2) | SEG(4) | SEG(5) | SEG(6),                   // E
+  SEG(1) | SEG(2) | SEG(4) | SEG(5),                            // F
+  };
+
+static Seg7Glyph seg7_cache[SEG7_CACHE_SLOTS];
+
+static int seg7_slot (int height, int thickness, char c)
+  {
+  unsigned h = height;
+  h = h * 31 + thickness;
+  h = h * 31 + (unsigned char)c;
+  return h % SEG7_CACHE_SLOTS;
+  }
+
+
+/* Set pixels x1,y1 to x2,y2 (exclusive) of the glyph mask, within the
+ * glyph */
+static void seg7_fill (Seg7Glyph *g, int x1, int y1, int x2, int y2)
+  {
+  int row_bytes = (g->glyph.w + 1) / 2;
+  if (x1 < 0) x1 = 0;
+  if (y1 < 0) y1 = 0;
+  if (x2 > g->glyph.w) x2 = g->glyph.w;
+  if (y2 > g->glyph.h) y2 = g->glyph.h;
+  for (int y = y1; y < y2; y++)
+    for (int x = x1; x < x2; x++)
+      g->mask[y * row_bytes + x / 2] |= x & 1 ? 0x0F : 0xF0;
+  }
+
+
+/* A segment is a thick line from x1,y1 to x2,y2, which is the 
+ * rectangle that spi_oled_draw_line() would fill */
+static void seg7_segment (Seg7Glyph *g, int x1, int y1, int x2, int y2)
+  {
+  int t = g->thickness;
+  seg7_fill (g, x1 < x2 ? x1 : x2, y1 < y2 ? y1 : y2, 
+    (x1 > x2 ? x1 : x2) + t, (y1 > y2 ? y1 : y2) + t);
+  }
+
+
+/* Rasterize the segments in 'mask' into a digit cell */
+static void seg7_segments (Seg7Glyph *g, int mask)
+  {
+  int t = g->thickness;
+  int height = g->height;
+  int width = height / 2;
+  int h2 = height / 2;
+  if (mask & SEG(1)) seg7_segment (g, t, 0, width - t, 0);
+  if (mask & SEG(2)) seg7_segment (g, 0, t, 0, h2 - t);
+  if (mask & SEG(3)) seg7_segment (g, width, t, width, h2 - t);
+  if (mask & SEG(4)) seg7_segment (g, t, h2, width - t, h2);
+  if (mask & SEG(5)) seg7_segment (g, 0, h2 + t, 0, height - t);
+  if (mask & SEG(6)) seg7_segment (g, t, height, width - t, height);
+  if (mask & SEG(7)) seg7_segment (g, width, h2 + t, width, height - t);
+  }
+
+
+/* The segment mask for c, or -1 for a character that isn't a digit */
+static int seg7_mask (char c)
+  {
+  if (c >= '0' && c <= '9') return seg7_digits[c - '0'];
+  if (c >= 'A' && c <= 'F') return seg7_digits[c - 'A' + 10];
+  if (c >= 'a' && c <= 'f') return seg7_digits[c - 'a' + 10];
+  if (c == '-') return SEG(4);
+  if (c == ' ') return 0;
+  return -1;
+  }
+
+
+static BOOL seg7_rasterize (Seg7Glyph *g, int height, int thickness, char c)
+  {
+  int t = thickness;
+  int mask = seg7_mask (c);
+  int w, h = height + t;
+  if (mask >= 0)
+    w = height / 2 + t;
+  else if (c == ':' || c == '.')
+    w = t;
+  else
+    return FALSE;
+
+  int size = (w + 1) / 2 * h;
+  if (size > g->capacity)
+    {
+    free (g->mask);
+    g->mask = malloc (size);
+    g->capacity = size;
+    }
+  memset (g->mask, 0, size);
+  g->height = height;
+  g->thickness = thickness;
+  g->c = c;
+  g->width = w;
+  g->glyph.offset = 0;
+  g->glyph.x = 0;
+  g->glyph.y = 0;
+  g->glyph.w = w;
+  g->glyph.h = h;
+  memset (&g->atlas, 0, sizeof (Atlas));
+  g->atlas.glyphs = &g->glyph;
+  g->atlas.data = g->mask;
+  g->atlas.format = ATLAS_MASKS;
+
+  int h2 = height / 2;
+  if (mask >= 0)
+    seg7_segments (g, mask);
+  else if (c == ':')
+    {
+    // Dots half way between the horizontal segments
+    seg7_fill (g, 0, h2 / 2, t, h2 / 2 + t);
+    seg7_fill (g, 0, (h2 + height) / 2, t, (h2 + height) / 2 + t);
+    }
+  else
+    {
+    // In line with the bottom segment
+    seg7_fill (g, 0, height, t, height + t);
+    }
+  return TRUE;
+  }
+
+
+const Seg7Glyph *seg7_get (int height, int thickness, char c)
+  {
+  if (height < 2 || thickness < 1 || height + thickness > 255) return NULL;
+  Seg7Glyph *g = &seg7_cache[seg7_slot (height, thickness, c)];
+  if (g->mask && g->height == height && g->thickness == thickness 
+       && g->c == c)
+    return g;
+  if (!seg7_rasterize (g, height, thickness, c)) return NULL;
+  return g;
+  }
+
+
+void seg7_cache_clear (void)
+  {
+  debug_log ("Call seg7_cache_clear");
+  for (int i = 0; i < SEG7_CACHE_SLOTS; i++)
+    {
+    free (seg7_cache[i].mask);
+    memset (&seg7_cache[i], 0, sizeof (Seg7Glyph));
+    }
+  }
+
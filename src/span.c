@@ -0,0 +1,230 @@
+/*========================================================================
+  spi-oled
+  span.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Functions for filling horizontal and vertical runs of pixels, and
+  rectangles, in a 4bpp frame buffer. Whole bytes -- two pixels -- are
+  written with memset() or the fill kernels, and only the odd pixels at
+  the ends of a run need a read-modify-write
+========================================================================*/
+#include <string.h>
+#include <spi_oled/span.h>
+#include <spi_oled/kernels.h>
+
+void span_hline (uint8_t *buffer, int stride, int x1, int x2, int y, 
+      uint8_t colour)
+  {
+  if (x1 >= x2) return;
+  colour &= 0x0F;
+  uint8_t *row = buffer + y * stride;
+
+  // A run that starts on an odd pixel starts in a low nibble
+  if (x1 & 1)
+    {
+    row[x1 / 2] = (row[x1 / 2] & 0xF0) | colour;
+    x1++;
+    }
+  // A run that ends on an even pixel ends in a high nibble
+  if ((x2 & 1) && x1 < x2)
+    {
+    row[x2 / 2] = (row[x2 / 2] & 0x0F) | (colour << 4);
+    x2--;
+    }
+  if (x1 < x2)
+    memset (row + x1 / 2, colour | (colour << 4), (x2 - x1) / 2);
+  }
+
+
+void span_vline (uint8_t *buffer, int stride, int x, int y1, int y2, 
+      uint8_t colour)
+  {
+  colour &= 0x0F;
+  uint8_t *p = buffer + y1 * stride + x / 2;
+  uint8_t mask, value;
+  if (x & 1)
+    {
+    mask = 0xF0;
+    value = colour;
+    }
+  else
+    {
+    mask = 0x0F;
+    value = colour << 4;
+    }
+  for (int y = y1; y < y2; y++)
+    {
+    *p = (*p & mask) | value;
+    p += stride;
+    }
+  }
+
+
+/* The odd pixels at either end of each row are nibble writes down a 
+ * column; everything between them is whole bytes, which are filled by the
+ * rectangular fill kernel */
+void span_fill_rect (uint8_t *buffer, int stride, int x1, int y1, 
+      int x2, int y2, uint8_t colour)
+  {
+  if (x1 >= x2 || y1 >= y2) return;
+  colour &= 0x0F;
+  if (x1 & 1)
+    {
+    span_vline (buffer, stride, x1, y1, y2, colour);
+    x1++;
+    }
+  if ((x2 & 1) && x1 < x2)
+    {
+    span_vline (buffer, stride, x2 - 1, y1, y2, colour);
+    x2--;
+    }
+  if (x1 >= x2) return;
+
+  uint8_t *p = buffer + y1 * stride + x1 / 2;
+  int n = (x2 - x1) / 2;
+  // Full-width rows are contiguous, so they can be filled in one go
+  if (n == stride)
+    kernels()->fill (p, colour | (colour << 4), n * (y2 - y1));
+  else
+    kernels()->fill_rect (p, stride, n, y2 - y1, colour | (colour << 4));
+  }
+
+
+/* span_key_mask[key][b] has ones in each nibble of the byte b that is
+ * not the key colour -- the pixels that a keyed blit copies */
+static uint8_t span_key_mask[16][256];
+static BOOL span_key_mask_ready = FALSE;
+
+static void span_key_mask_init (void)
+  {
+  for (int k = 0; k < 16; k++)
+    for (int b = 0; b < 256; b++)
+      span_key_mask[k][b] = ((b >> 4) == k ? 0 : 0xF0) 
+        | ((b & 0x0F) == k ? 0 : 0x0F);
+  span_key_mask_ready = TRUE;
+  }
+
+
+/* Combine two pixels of the source byte s with two of the destination
+ * byte d. keys is the row of span_key_mask for the key colour */
+static inline uint8_t span_rop (uint8_t d, uint8_t s, SPIOledRop rop,
+      const uint8_t *keys)
+  {
+  switch (rop)
+    {
+    case SPI_OLED_ROP_XOR: return d ^ s;
+    case SPI_OLED_ROP_OR: return d | s;
+    case SPI_OLED_ROP_AND: return d & s;
+    case SPI_OLED_ROP_KEY: return (s & keys[s]) | (d & ~keys[s]);
+    default: return s;
+    }
+  }
+
+
+/* A single pixel is combined as a byte with the same colour in both
+ * nibbles, and the nibble that matters written back */
+static inline void span_rop_pixel (uint8_t *d, int dx, uint8_t colour,
+      SPIOledRop rop, const uint8_t *keys)
+  {
+  uint8_t u = span_get (d, 0, dx, 0);
+  span_pixel (d, 0, dx, 0, 
+    span_rop (u * 0x11, colour * 0x11, rop, keys) & 0x0F);
+  }
+
+
+void span_fill_rect_rop (uint8_t *buffer, int stride, int x1, int y1, 
+      int x2, int y2, uint8_t colour, SPIOledRop rop)
+  {
+  if (rop == SPI_OLED_ROP_COPY || rop == SPI_OLED_ROP_KEY)
+    {
+    span_fill_rect (buffer, stride, x1, y1, x2, y2, colour);
+    return;
+    }
+  if (x1 >= x2 || y1 >= y2) return;
+  uint8_t c = (colour & 0x0F) * 0x11;
+  for (int y = y1; y < y2; y++)
+    {
+    uint8_t *row = buffer + y * stride;
+    int x = x1, end = x2;
+    if (x & 1)
+      span_rop_pixel (row, x++, colour & 0x0F, rop, NULL);
+    if ((end & 1) && x < end)
+      span_rop_pixel (row, --end, colour & 0x0F, rop, NULL);
+    for (uint8_t *p = row + x / 2; x < end; x += 2, p++)
+      *p = span_rop (*p, c, rop, NULL);
+    }
+  }
+
+
+/* Combine n pixels from pixel sx of the row src with n pixels from pixel
+ * dx of the row dst. If the two start in the same half of a byte, the
+ * bytes between the end pixels are combined as they are. If not, each
+ * source byte is made from the low nibble of one byte and the high 
+ * nibble of the next. Copying bytes that line up is left to the copy
+ * kernel */
+static void span_rop_row (uint8_t *dst, int dx, const uint8_t *src, int sx,
+      int n, SPIOledRop rop, const uint8_t *keys)
+  {
+  if (dx & 1)
+    {
+    span_rop_pixel (dst, dx, span_get (src, 0, sx, 0), rop, keys);
+    dx++;
+    sx++;
+    n--;
+    }
+  uint8_t *d = dst + dx / 2;
+  const uint8_t *s = src + sx / 2;
+  int bytes = n / 2;
+  if (sx & 1)
+    {
+    for (int i = 0; i < bytes; i++)
+      d[i] = span_rop (d[i], (s[i] << 4) | (s[i + 1] >> 4), rop, keys);
+    }
+  else if (rop == SPI_OLED_ROP_COPY)
+    kernels()->copy (d, s, bytes);
+  else
+    {
+    for (int i = 0; i < bytes; i++)
+      d[i] = span_rop (d[i], s[i], rop, keys);
+    }
+  if (n & 1)
+    span_rop_pixel (dst, dx + n - 1, span_get (src, 0, sx + n - 1, 0), 
+      rop, keys);
+  }
+
+
+void span_copy_rect (uint8_t *dst, int dst_stride, int dx, int dy, 
+      const uint8_t *src, int src_stride, int sx, int sy, int w, int h)
+  {
+  span_rop_rect (dst, dst_stride, dx, dy, src, src_stride, sx, sy, w, h,
+    SPI_OLED_ROP_COPY, 0);
+  }
+
+
+void span_rop_rect (uint8_t *dst, int dst_stride, int dx, int dy, 
+      const uint8_t *src, int src_stride, int sx, int sy, int w, int h,
+      SPIOledRop rop, uint8_t key)
+  {
+  if (w <= 0) return;
+  if (!span_key_mask_ready) span_key_mask_init ();
+  const uint8_t *keys = span_key_mask[key & 0x0F];
+  for (int row = 0; row < h; row++)
+    span_rop_row (dst + (dy + row) * dst_stride, dx, 
+      src + (sy + row) * src_stride, sx, w, rop, keys);
+  }
+
+
+uint8_t span_blend_table[16][16][16];
+static BOOL span_blend_ready = FALSE;
+
+void span_blend_init (void)
+  {
+  if (span_blend_ready) return;
+  for (int a = 0; a < 16; a++)
+    for (int o = 0; o < 16; o++)
+      for (int u = 0; u < 16; u++)
+        span_blend_table[a][o][u] = (o * a + u * (15 - a) + 7) / 15;
+  span_blend_ready = TRUE;
+  }
+
@@ -19,6 +19,26 @@
 #include <spi_oled/spi.h>
 #include <spi_oled/debug.h>
 
+#define SPI_BUFSIZ_PARAM "/sys/module/spidev/parameters/bufsiz"
+
+/* Read the spidev driver's message size limit. It can be raised by
+ * adding, e.g., spidev.bufsiz=65536 to the kernel command line, in 
+ * which case a whole frame fits into a single ioctl() */
+static int spi_get_bufsiz (void)
+  {
+  int bufsiz = SPI_DEFAULT_BUFSIZ;
+  FILE *f = fopen (SPI_BUFSIZ_PARAM, "r");
+  if (f)
+    {
+    if (fscanf (f, "%d", &bufsiz) != 1 || bufsiz <= 0)
+      bufsiz = SPI_DEFAULT_BUFSIZ;
+    fclose (f);
+    }
+  else
+    debug_log ("Can't read %s, assuming %d", SPI_BUFSIZ_PARAM, bufsiz);
+  return bufsiz;
+  }
+
 SPI* spi_open (const char *dev)
   {
   debug_log ("Call spi_open, dev=%s", dev); 
@@ -26,7 +46,12 @@ SPI* spi_open (const char *dev)
   if (fd > 0)
     {
     SPI *self = malloc (sizeof (SPI));
+    memset (self, 0, sizeof (SPI));
     self->fd = fd;
+    self->max_block = spi_get_bufsiz ();
+    if (self->max_block >= SPI_TRANSFER_ALIGN)
+      self->max_block &= ~(SPI_TRANSFER_ALIGN - 1);
+    debug_log ("SPI maximum message size is %d", self->max_block);
     uint8_t bits = 8;
     int ret = ioctl (fd, SPI_IOC_WR_BITS_PER_WORD, &bits);
     if (ret == -1) 
@@ -198,13 +223,13 @@ int spi_set_data_interval (SPI *self, int interval)
   }
 
 
-// What does this return? If anything?
+/* All writes are TX-only -- rx_buf is zero, so the kernel does not copy 
+ * whatever arrives on MISO back into the caller's buffer */
 int spi_write_byte (SPI *self, uint8_t value)
   {
-  uint8_t rbuf[1];
   self->tr.len = 1;
   self->tr.tx_buf = (unsigned long)&value;
-  self->tr.rx_buf = (unsigned long)rbuf;
+  self->tr.rx_buf = 0;
 
   if (ioctl (self->fd, SPI_IOC_MESSAGE(1), &(self->tr)) < 1)
     {
@@ -212,15 +237,15 @@ int spi_write_byte (SPI *self, uint8_t value)
     return -1;
     }
 
-  return rbuf[0];
+  return 0;
   }
 
 
-int spi_write_bytes (SPI *self, uint8_t *buf, int len)
+int spi_write_bytes (SPI *self, const uint8_t *buf, int len)
   {
   self->tr.len = len;
   self->tr.tx_buf =  (unsigned long)buf;
-  self->tr.rx_buf =  (unsigned long)buf;
+  self->tr.rx_buf =  0;
 
   if (ioctl (self->fd, SPI_IOC_MESSAGE(1), &(self->tr))  < 1 )
     {
@@ -232,6 +257,68 @@ int spi_write_bytes (SPI *self, uint8_t *buf, int len)
   }
 
 
+/* Submit the first n transfers in tr as a single message */
+static int spi_submit (SPI *self, struct spi_ioc_transfer *tr, int n)
+  {
+  if (n == 0) return 0;
+  if (ioctl (self->fd, SPI_IOC_MESSAGE(n), tr) < 1)
+    {
+    debug_log ("ioctl() failed in spi_write_rows: %s", strerror (errno));
+    return -1;
+    }
+  return 0;
+  }
+
+
+/* Gather the rows into an array of transfers, and submit as many of them
+ * per ioctl() as the driver will take. When the rows are contiguous, they
+ * are coalesced into transfers as large as the driver allows */
+int spi_write_rows (SPI *self, const uint8_t *buf, int row_len, int stride, 
+      int rows)
+  {
+  struct spi_ioc_transfer tr[SPI_MAX_TRANSFERS];
+  int n = 0;
+  int total = 0;
+
+  if (row_len == stride)
+    {
+    row_len *= rows;
+    stride = row_len;
+    rows = 1;
+    }
+
+  for (int row = 0; row < rows; row++)
+    {
+    const uint8_t *p = buf + row * stride;
+    int left = row_len;
+    while (left > 0)
+      {
+      int len = left < self->max_block ? left : self->max_block;
+      int aligned = (len + SPI_TRANSFER_ALIGN - 1) 
+         & ~(SPI_TRANSFER_ALIGN - 1);
+      if (n == SPI_MAX_TRANSFERS 
+           || (n > 0 && total + aligned > self->max_block))
+        {
+        if (spi_submit (self, tr, n) != 0) return -1;
+        n = 0;
+        total = 0;
+        }
+      tr[n] = self->tr;
+      tr[n].len = len;
+      tr[n].tx_buf = (unsigned long)p;
+      tr[n].rx_buf = 0;
+      tr[n].cs_change = 0;
+      n++;
+      total += aligned;
+      p += len;
+      left -= len;
+      }
+    }
+
+  return spi_submit (self, tr, n);
+  }
+
+
 void spi_close (SPI *self)
   {
   debug_log ("Call spi_close"); 
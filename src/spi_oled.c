@@ -18,6 +18,12 @@
 #include <spi_oled/debug.h>
 #include <spi_oled/spi.h>
 #include <spi_oled/fonts.h>
+#include <spi_oled/span.h>
+#include <spi_oled/kernels.h>
+#include <spi_oled/glyph_cache.h>
+#include <spi_oled/atlas.h>
+#include <spi_oled/utf8.h>
+#include <spi_oled/seg7.h>
 
 static void spi_oled_delay_msec (int d)
   {
@@ -26,13 +32,21 @@ static void spi_oled_delay_msec (int d)
   }
 
 
+/* Send a sequence of command bytes in one transaction. DC and CS are set
+ * once, and all the bytes go out in a single ioctl() */
+void spi_oled_write_cmds (SPIOled *self, const uint8_t *cmds, int n)
+  {
+  debug_log ("Call spi_oled_write_cmds, n=%d", n);
+  gpio_set_multi (self->gpio, OLED_BIT_DC | OLED_BIT_CS, 0);
+  spi_write_bytes (self->spi, cmds, n);
+  gpio_set (self->gpio, OLED_LINE_CS, GPIO_HIGH);
+  }
+
+
 static void spi_oled_write_reg (SPIOled *self, uint8_t value)
   {
   debug_log ("Call spi_oled_write_reg, value=%02x", value);
-  gpio_set_pin (OLED_DC, GPIO_LOW);
-  gpio_set_pin (OLED_CS, GPIO_LOW);
-  spi_write_byte (self->spi, value);
-  gpio_set_pin (OLED_CS, GPIO_HIGH);
+  spi_oled_write_cmds (self, &value, 1);
   }
 
 
@@ -40,319 +54,965 @@ static void spi_oled_write_reg (SPIOled *self, uint8_t value)
  * do. Some I figured out from other people's code, others by 
  * trial and error 
  */
+static const uint8_t spi_oled_init_cmds[] = 
+  {
+  0xae,              // turn off 
+  0x15, 0x00, 0x7f,  // set column address, start 0, end 127
+  0x75, 0x00, 0x7f,  // set row address, start 0, end 127
+  0x81, 0x40,        // set contrast control
+  0xa0, 0x51,        // segment remap
+  0xa1, 0x00,        // start line
+  0xa2, 0x00,        // display offset
+  0xa4,              // normal display
+  0xa8, 0x7f,        // set multiplex ratio
+  0xb1, 0xf1,        // set phase length
+  0xb3, 0x00,        // set dclk
+  0xab, 0x01, 
+  0xb6, 0x0f,        // set phase length
+  0xbe, 0x04,
+  0xbc, 0x08,
+  0xd5, 0x62,
+  0xfd, 0x12,
+  };
+
 static void spi_oled_init_reg (SPIOled *self)
   {
   debug_log ("Call spi_oled_init_reg");
-  spi_oled_write_reg (self, 0xae);  // turn off 
-
-  spi_oled_write_reg (self, 0x15);  //  set column address
-  spi_oled_write_reg (self, 0x00);  //  start column   0
-  spi_oled_write_reg (self, 0x7f);  //  end column   127
+  spi_oled_write_cmds (self, spi_oled_init_cmds, 
+    sizeof (spi_oled_init_cmds));
+  // The init sequence sets its own window, so we can't assume that
+  //  the last one we set is still in force
+  self->window_valid = FALSE;
+  }
 
-  spi_oled_write_reg (self, 0x75);  //  set row address
-  spi_oled_write_reg (self, 0x00);  //  start row   0
-  spi_oled_write_reg (self, 0x7f);  //  end row   127
 
-  spi_oled_write_reg (self, 0x81);  // set contrast control
-  spi_oled_write_reg (self, 0x40);
+/* Add the part of x1,y1 to x2,y2 (exclusive) that is inside the clip
+ * rectangle to the damage rectangle */
+static void spi_oled_mark_dirty_clipped (SPIOled *self, int x1, int y1, 
+      int x2, int y2)
+  {
+  if (x1 < self->clip_x1) x1 = self->clip_x1;
+  if (y1 < self->clip_y1) y1 = self->clip_y1;
+  if (x2 > self->clip_x2) x2 = self->clip_x2;
+  if (y2 > self->clip_y2) y2 = self->clip_y2;
+  spi_oled_mark_dirty (self, x1, y1, x2, y2);
+  }
 
-  spi_oled_write_reg (self, 0xa0);  // gment remap
-  spi_oled_write_reg (self, 0x51); 
 
-  spi_oled_write_reg (self, 0xa1);  // start line
-  spi_oled_write_reg (self, 0x00);
+/* Fill the rectangle x1,y1 to x2,y2 (exclusive), clipped,
+ * and add it to the damage rectangle */
+static void spi_oled_fill (SPIOled *self, int x1, int y1, int x2, int y2, 
+      uint8_t colour)
+  {
+  if (x1 < self->clip_x1) x1 = self->clip_x1;
+  if (y1 < self->clip_y1) y1 = self->clip_y1;
+  if (x2 > self->clip_x2) x2 = self->clip_x2;
+  if (y2 > self->clip_y2) y2 = self->clip_y2;
+  if (x1 >= x2 || y1 >= y2) return;
+  span_fill_rect (self->target->buffer, self->target->stride, x1, y1, 
+    x2, y2, colour);
+  spi_oled_mark_dirty (self, x1, y1, x2, y2);
+  }
 
-  spi_oled_write_reg (self, 0xa2);  // display offset
-  spi_oled_write_reg (self, 0x00);
 
-  spi_oled_write_reg (self, 0xa4);  // rmal display
-  spi_oled_write_reg (self, 0xa8);  // set multiplex ratio
-  spi_oled_write_reg (self, 0x7f);
+/* Draw a character from a font's pre-expanded atlas, which needs no
+ * decoding and no cache */
+static void spi_oled_draw_atlas_glyph (SPIOled *self, int x, int y, 
+    const sFONT *font, uint32_t c, uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  const AtlasGlyph *g = atlas_glyph (font->atlas, c);
+  if (!g)
+    {
+    if (opaque)
+      spi_oled_fill (self, x, y, x + font->Width, y + font->Height, bg);
+    return;
+    }
+  atlas_blit (font->atlas, g, self->target->buffer, self->target->stride, 
+    x, y, font->Width, font->Height, self->clip_x1, self->clip_y1, 
+    self->clip_x2, self->clip_y2, fg, bg, opaque);
+  if (opaque)
+    spi_oled_mark_dirty_clipped (self, x, y, x + font->Width, 
+      y + font->Height);
+  else
+    spi_oled_mark_dirty_clipped (self, x + g->x, y + g->y, 
+      x + g->x + g->w, y + g->y + g->h);
+  }
 
-  spi_oled_write_reg (self, 0xb1);  // set phase leghth
-  spi_oled_write_reg (self, 0xf1);
 
-  spi_oled_write_reg (self, 0xb3);  // set dclk
-  spi_oled_write_reg (self, 0x00);  
+/* Draw the character with code point c in colour fg and, if opaque is 
+ * TRUE, fill the rest of its box with bg. Fonts with an atlas are looked
+ * up by code point; the plain tables only have ASCII. The glyph box is 
+ * clipped once, up front. If the full width of the glyph is visible, the
+ * cached glyph mask is written a byte -- two pixels -- at a time.
+ * Otherwise the loops cover only the visible part of the glyph, and the
+ * pixels are written individually, unchecked.
+ * In opaque mode, a character that isn't in the font is drawn as a 
+ * blank box */
+static void spi_oled_draw_glyph (SPIOled *self, int x, int y, 
+    const sFONT *font, uint32_t c, uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  if (font->atlas)
+    {
+    spi_oled_draw_atlas_glyph (self, x, y, font, c, fg, bg, opaque);
+    return;
+    }
 
-  spi_oled_write_reg (self, 0xab); 
-  spi_oled_write_reg (self, 0x01); 
+  if (c < ' ' || c > '~') 
+    {
+    if (opaque)
+      spi_oled_fill (self, x, y, x + font->Width, y + font->Height, bg);
+    return;
+    }
 
-  spi_oled_write_reg (self, 0xb6);  // set phase leghth
-  spi_oled_write_reg (self, 0x0f);
+  int bytes_per_row = (font->Width + 7) / 8;
+  const uint8_t *glyph = &font->table[(c - ' ') * font->Height 
+    * bytes_per_row];
 
-  spi_oled_write_reg (self, 0xbe);
-  spi_oled_write_reg (self, 0x04);
+  int col1 = self->clip_x1 > x ? self->clip_x1 - x : 0;
+  int row1 = self->clip_y1 > y ? self->clip_y1 - y : 0;
+  int col2 = self->clip_x2 < x + font->Width 
+    ? self->clip_x2 - x : font->Width;
+  int row2 = self->clip_y2 < y + font->Height 
+    ? self->clip_y2 - y : font->Height;
+  if (col1 >= col2 || row1 >= row2) return;
 
-  spi_oled_write_reg (self, 0xbc);
-  spi_oled_write_reg (self, 0x08);
+  int stride = self->target->stride;
+  if (col1 == 0 && col2 == font->Width)
+    {
+    const Glyph *g = glyph_cache_get (font, c, x & 1);
+    if (opaque)
+      glyph_blit_opaque (g, self->target->buffer, stride, x, y, row1, row2, 
+        fg, bg);
+    else
+      glyph_blit (g, self->target->buffer, stride, x, y, row1, row2, fg);
+    }
+  else
+    {
+    for (int row = row1; row < row2; row++) 
+      {
+      const uint8_t *ptr = glyph + row * bytes_per_row;
+      for (int column = col1; column < col2; column++) 
+        {
+        if (ptr[column / 8] & (0x80 >> (column % 8)))
+          span_pixel (self->target->buffer, stride, x + column, y + row, fg);
+        else if (opaque)
+          span_pixel (self->target->buffer, stride, x + column, y + row, bg);
+        }
+      }
+    }
+  spi_oled_mark_dirty (self, x + col1, y + row1, x + col2, y + row2);
+  }
 
-  spi_oled_write_reg (self, 0xd5);
-  spi_oled_write_reg (self, 0x62);
 
-  spi_oled_write_reg (self, 0xfd);
-  spi_oled_write_reg (self, 0x12);
+/* The string is decoded from UTF-8 as it is drawn, in one pass. Characters
+ * that are entirely outside the clip rectangle are decoded but not looked 
+ * up, and drawing stops at the first character that starts beyond the 
+ * rectangle's right-hand edge */
+static void spi_oled_draw_text (SPIOled *self, int x, int y, 
+    const sFONT *font, const char *s, uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  if (y >= self->clip_y2 || y + font->Height <= self->clip_y1) return;
+  while (*s && x < self->clip_x2)
+    {
+    uint32_t c = utf8_next (&s);
+    if (x + font->Width > self->clip_x1)
+      spi_oled_draw_glyph (self, x, y, font, c, fg, bg, opaque);
+    x += font->Width;
+    }
   }
 
 
 void spi_oled_draw_string (SPIOled *self, uint16_t x, uint16_t y, 
     const sFONT *font, const char *s, uint8_t colour)
   {
-  int l = strlen (s);
-  for (int i = 0; i < l; i++)
-    {
-    spi_oled_draw_char (self, x, y, font, s[i], colour);
-    x += font->Width;
-    }
+  spi_oled_draw_text (self, x, y, font, s, colour, 0, FALSE);
   }
 
+
+void spi_oled_draw_string_opaque (SPIOled *self, uint16_t x, uint16_t y, 
+    const sFONT *font, const char *s, uint8_t fg, uint8_t bg)
+  {
+  spi_oled_draw_text (self, x, y, font, s, fg, bg, TRUE);
+  }
+
+
 void spi_oled_draw_char (SPIOled *self, uint16_t x, uint16_t y, 
     const sFONT *font, char c, uint8_t colour)
   {
-  if (c < ' ' || c > 127) return;
-
-  int char_offset = (c - ' ') * font->Height * 
-       (font->Width / 8 + (font->Width % 8 ? 1 : 0));
-  const unsigned char *ptr = &font->table[char_offset];
-
-   for (int page = 0; page < font->Height; page++) 
-     {
-     for (int column = 0; column < font->Width; column++) 
-       {
-       if (*ptr & (0x80 >>(column % 8)))
-         //spi_oled_draw_square (self, x + column, y + page, 1, colour, TRUE);
-         spi_oled_set_pixel (self, x + column, y + page, colour);
-       if (column % 8 == 7) ptr++;
-       }
-     if (font->Width % 8 != 0) ptr++;
-     }
-  }
-
-
-/*
- *      1
- *    2   3
- *      4
- *    5   7
- *      6
- */     
-static void spi_oled_draw_seqment (SPIOled *self, uint16_t x, uint16_t y, 
-      uint16_t width, uint16_t height, int thickness, int seg, uint8_t colour)
-  {
-  int h2 = height / 2;
-  if (seg == 1)
-    spi_oled_draw_line (self, x + thickness, y, x + width - thickness, y, 
-      thickness, colour);
-  else if (seg == 2)
-    spi_oled_draw_line (self, x, y + thickness, x, y + h2 - thickness, 
-      thickness, colour);
-  else if (seg == 3)
-    spi_oled_draw_line (self, x + width, y + thickness, x + width, 
-      y + h2 - thickness, thickness, colour);
-  else if (seg == 4)
-    spi_oled_draw_line (self, x + thickness, y + h2, 
-      x + width - thickness, y + h2, 
-        thickness, colour);
-  else if (seg == 5)
-    spi_oled_draw_line (self, x, y + h2 + thickness, 
-      x, y + height - thickness, thickness, colour);
-  else if (seg == 6)
-    spi_oled_draw_line (self, x + thickness, y + height,
-      x + width - thickness, y + height, 
-        thickness, colour);
-  else if (seg == 7)
-    spi_oled_draw_line (self, x + width, y + h2 + thickness,
-      x + width, y + height - thickness, 
-        thickness, colour);
+  spi_oled_draw_glyph (self, x, y, font, (uint8_t)c, colour, 0, FALSE);
+  }
+
+
+void spi_oled_draw_char_opaque (SPIOled *self, uint16_t x, uint16_t y, 
+    const sFONT *font, char c, uint8_t fg, uint8_t bg)
+  {
+  spi_oled_draw_glyph (self, x, y, font, (uint8_t)c, fg, bg, TRUE);
+  }
+
+
+void spi_oled_draw_codepoint (SPIOled *self, uint16_t x, uint16_t y, 
+    const sFONT *font, uint32_t c, uint8_t colour)
+  {
+  spi_oled_draw_glyph (self, x, y, font, c, colour, 0, FALSE);
+  }
+
+
+void spi_oled_draw_codepoint_opaque (SPIOled *self, uint16_t x, uint16_t y, 
+    const sFONT *font, uint32_t c, uint8_t fg, uint8_t bg)
+  {
+  spi_oled_draw_glyph (self, x, y, font, c, fg, bg, TRUE);
+  }
+
+
+/* Draw a 7-segment character from the cache, which rasterizes it the first
+ * time it is used at this size. Returns the width of the character, or 0
+ * if there is no such character */
+static int spi_oled_draw_7seg (SPIOled *self, int x, int y, int height, 
+      int thickness, char c, uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  const Seg7Glyph *g = seg7_get (height, thickness, c);
+  if (!g) return 0;
+  atlas_blit (&g->atlas, &g->glyph, self->target->buffer, 
+    self->target->stride, x, y, g->glyph.w, g->glyph.h, self->clip_x1, 
+    self->clip_y1, self->clip_x2, self->clip_y2, fg, bg, opaque);
+  spi_oled_mark_dirty_clipped (self, x, y, x + g->glyph.w, 
+    y + g->glyph.h);
+  return g->width;
   }
 
+
 void spi_oled_draw_7seg_digit (SPIOled *self, uint16_t x, uint16_t y, 
       uint16_t height, int thickness, int val, uint8_t colour)
   {
-  int width = height / 2;
-  if (val == 0)
+  if (val < 0 || val > 15) return;
+  spi_oled_draw_7seg (self, x, y, height, thickness, 
+    "0123456789ABCDEF"[val], colour, 0, FALSE);
+  }
+
+
+/* Characters are separated by a gap of one segment thickness */
+static void spi_oled_draw_7seg_text (SPIOled *self, int x, int y, 
+      int height, int thickness, const char *s, uint8_t fg, uint8_t bg, 
+      BOOL opaque)
+  {
+  for (; *s && x < self->clip_x2; s++)
     {
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 1, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 2, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 3, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 5, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 6, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 7, colour);
-    } 
-  else if (val == 1)
+    int w = spi_oled_draw_7seg (self, x, y, height, thickness, *s, 
+      fg, bg, opaque);
+    if (w == 0) continue;
+    x += w;
+    if (opaque && s[1])
+      spi_oled_fill (self, x, y, x + thickness, y + height + thickness, bg);
+    x += thickness;
+    }
+  }
+
+
+void spi_oled_draw_7seg_string (SPIOled *self, uint16_t x, uint16_t y, 
+      uint16_t height, int thickness, const char *s, uint8_t colour)
+  {
+  spi_oled_draw_7seg_text (self, x, y, height, thickness, s, colour, 0, 
+    FALSE);
+  }
+
+
+void spi_oled_draw_7seg_string_opaque (SPIOled *self, uint16_t x, 
+      uint16_t y, uint16_t height, int thickness, const char *s, 
+      uint8_t fg, uint8_t bg)
+  {
+  spi_oled_draw_7seg_text (self, x, y, height, thickness, s, fg, bg, TRUE);
+  }
+
+
+void spi_oled_draw_square (SPIOled *self, uint16_t x1, uint16_t y1, 
+      uint16_t length, uint8_t colour, BOOL fill)
+  {
+  spi_oled_draw_rect (self, x1, y1, x1 + length, y1 + length, colour, fill);
+  }
+
+
+/* A Bresenham walk along a line, one row at a time. The steps are exactly
+ * those of the single-pixel line, so a line's pixels don't depend on how
+ * it is drawn */
+typedef struct _LineWalk
+  {
+  int x, y, x2, y2;
+  int dx, dy, xadd, yadd, esp;
+  } LineWalk;
+
+
+static void line_walk_init (LineWalk *w, int x1, int y1, int x2, int y2)
+  {
+  w->x = x1;
+  w->y = y1;
+  w->x2 = x2;
+  w->y2 = y2;
+  w->dx = x2 - x1 >= 0 ? x2 - x1 : x1 - x2;
+  w->dy = y2 - y1 <= 0 ? y2 - y1 : y1 - y2;
+  w->xadd = x1 < x2 ? 1 : -1;
+  w->yadd = y1 < y2 ? 1 : -1;
+  w->esp = w->dx + w->dy;
+  }
+
+
+/* Take one step, or return FALSE at the end of the line */
+static inline BOOL line_walk_step (LineWalk *w)
+  {
+  if (2 * w->esp >= w->dy)
     {
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 3, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 7, colour);
+    if (w->x == w->x2) return FALSE;
+    w->esp += w->dy;
+    w->x += w->xadd;
     }
-  else if (val == 2)
+  if (2 * w->esp <= w->dx)
     {
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 1, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 3, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 4, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 5, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 6, colour);
+    if (w->y == w->y2) return FALSE;
+    w->esp += w->dx;
+    w->y += w->yadd;
     }
-  else if (val == 3)
+  return TRUE;
+  }
+
+
+/* Walk the pixels of the current row, giving the range of x they cover,
+ * and stop at the first pixel of the next row */
+static void line_walk_row (LineWalk *w, int *x1, int *x2)
+  {
+  int y = w->y;
+  *x1 = *x2 = w->x;
+  while (line_walk_step (w) && w->y == y)
     {
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 1, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 3, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 4, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 7, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 6, colour);
+    if (w->x < *x1) *x1 = w->x;
+    if (w->x > *x2) *x2 = w->x;
     }
-  else if (val == 4)
+  }
+
+
+/* A thick line is the set of thickness x thickness squares whose top-left
+ * corners are the pixels of the single-pixel line. x only ever moves one
+ * way along a line, so each row of that shape is a single span, from the
+ * leftmost to the rightmost square that overlaps it -- and those are the
+ * squares on the first and last of the 'thickness' line rows above it. 
+ * So the line is walked twice at once, thickness - 1 rows apart, and each
+ * row of the stroke is filled with one span. A single-pixel line is the
+ * same with the two walks together, giving one span for each row. 
+ * Horizontal and vertical lines are just rectangles */
+void spi_oled_draw_line (SPIOled *self, uint16_t x1, uint16_t y1, 
+      uint16_t x2, uint16_t y2, int thickness, uint8_t colour)
+  {
+  if (thickness < 1) return;
+  int t = thickness;
+  int bx1 = x1 < x2 ? x1 : x2;
+  int by1 = y1 < y2 ? y1 : y2;
+  int bx2 = (x1 > x2 ? x1 : x2) + t;
+  int by2 = (y1 > y2 ? y1 : y2) + t;
+  if (x1 == x2 || y1 == y2)
     {
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 2, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 3, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 4, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 7, colour);
+    spi_oled_fill (self, bx1, by1, bx2, by2, colour);
+    return;
     }
-  else if (val == 5)
+  if (bx1 >= self->clip_x2 || by1 >= self->clip_y2 
+       || bx2 <= self->clip_x1 || by2 <= self->clip_y1)
+    return;
+
+  int stride = self->target->stride;
+  int yadd = y1 < y2 ? 1 : -1;
+  int rows = (y1 < y2 ? y2 - y1 : y1 - y2) + 1;
+  LineWalk lead, lag;
+  line_walk_init (&lead, x1, y1, x2, y2);
+  line_walk_init (&lag, x1, y1, x2, y2);
+  int lead_x1, lead_x2, lag_x1, lag_x2;
+  line_walk_row (&lead, &lead_x1, &lead_x2);
+  line_walk_row (&lag, &lag_x1, &lag_x2);
+
+  // Stroke row j is covered by line rows j - t + 1 to j. Going down, it
+  //  is at y1 + j; going up, the rows are counted from the bottom
+  for (int j = 0; j < rows + t - 1; j++)
     {
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 1, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 2, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 4, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 6, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 7, colour);
+    if (j > 0 && j < rows) 
+      line_walk_row (&lead, &lead_x1, &lead_x2);
+    if (j - t + 1 > 0) 
+      line_walk_row (&lag, &lag_x1, &lag_x2);
+    int y = yadd > 0 ? y1 + j : y1 + t - 1 - j;
+    if (y < self->clip_y1 || y >= self->clip_y2) continue;
+    int sx1 = lead_x1 < lag_x1 ? lead_x1 : lag_x1;
+    int sx2 = (lead_x2 > lag_x2 ? lead_x2 : lag_x2) + t;
+    if (sx1 < self->clip_x1) sx1 = self->clip_x1;
+    if (sx2 > self->clip_x2) sx2 = self->clip_x2;
+    if (sx1 < sx2)
+      span_hline (self->target->buffer, stride, sx1, sx2, y, colour);
     }
-  else if (val == 6)
+  spi_oled_mark_dirty_clipped (self, bx1, by1, bx2, by2);
+  }
+
+
+/* sin() of 0 to 90 degrees, scaled by 16384, for the arc end angles */
+static const int16_t spi_oled_sin_table[91] =
+  {
+  0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+  2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+  5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+  8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+  10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+  12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+  14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+  15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+  16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+  16384
+  };
+
+
+static int spi_oled_sin (int degrees)
+  {
+  degrees %= 360;
+  if (degrees < 0) degrees += 360;
+  if (degrees <= 90) return spi_oled_sin_table[degrees];
+  if (degrees <= 180) return spi_oled_sin_table[180 - degrees];
+  if (degrees <= 270) return -spi_oled_sin_table[degrees - 180];
+  return -spi_oled_sin_table[360 - degrees];
+  }
+
+
+/* The part of each row that a curve covers is worked out with the 
+ * midpoint test: a pixel is inside an ellipse of radii rx,ry if its 
+ * centre is inside the ellipse of radii rx+1/2,ry+1/2. In integers, 
+ * x,y is inside if (2x)^2(2ry+1)^2 + (2y)^2(2rx+1)^2 <= (2rx+1)^2(2ry+1)^2.
+ * The half-width of row y is the largest x that passes, and it only 
+ * shrinks as y moves away from the centre, so the rows are taken in 
+ * that order, and finding all of them is a single walk down from rx */
+typedef struct _CurveRows
+  {
+  int64_t a2, b2;
+  int x;
+  } CurveRows;
+
+
+static void curve_rows_init (CurveRows *c, int rx, int ry)
+  {
+  c->a2 = (int64_t)(2 * rx + 1) * (2 * rx + 1);
+  c->b2 = (int64_t)(2 * ry + 1) * (2 * ry + 1);
+  c->x = rx;
+  }
+
+
+/* The half-width of row y, or -1 if the ellipse doesn't reach it. 
+ * Successive calls must not decrease y */
+static int curve_rows_width (CurveRows *c, int y)
+  {
+  int64_t yy = 4 * (int64_t)y * y * c->a2;
+  while (c->x >= 0 && 4 * (int64_t)c->x * c->x * c->b2 + yy > c->a2 * c->b2)
+    c->x--;
+  return c->x;
+  }
+
+
+/* An angular range, for arcs. Angles are in degrees, clockwise from 
+ * 3 o'clock, as y increases downwards. A point is inside a range of up to
+ * 180 degrees if it is clockwise of the start and anticlockwise of the 
+ * end -- both of which are cross products, and so linear in x along a 
+ * row. A wider range is everything outside the narrower range from the 
+ * end round to the start */
+typedef struct _CurveSector
+  {
+  int sx, sy, ex, ey; // Directions of the start and end, scaled by 16384
+  BOOL reflex;        // More than 180 degrees
+  } CurveSector;
+
+
+/* Set up a sector. Returns FALSE if it covers nothing */
+static BOOL curve_sector_init (CurveSector *s, int start, int end)
+  {
+  int sweep = end - start;
+  if (sweep <= 0) return FALSE;
+  s->sx = spi_oled_sin (start + 90);
+  s->sy = spi_oled_sin (start);
+  s->ex = spi_oled_sin (end + 90);
+  s->ey = spi_oled_sin (end);
+  s->reflex = sweep > 180;
+  return TRUE;
+  }
+
+
+/* Restrict lo..hi to the x that satisfy a*x + b >= 0 */
+static void curve_half_line (int64_t a, int64_t b, int *lo, int *hi)
+  {
+  if (a > 0)
+    {
+    // x >= -b/a, rounded up
+    int64_t n = -b;
+    int64_t x = n >= 0 ? (n + a - 1) / a : -((-n) / a);
+    if (x > *lo) *lo = x;
+    }
+  else if (a < 0)
     {
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 1, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 2, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 4, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 5, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 6, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 7, colour);
+    // x <= b/-a, rounded down
+    int64_t d = -a;
+    int64_t x = b >= 0 ? b / d : -((-b + d - 1) / d);
+    if (x < *hi) *hi = x;
     }
-  else if (val == 7)
+  else if (b < 0)
+    *lo = *hi + 1;
+  }
+
+
+/* Fill x1 to x2 (inclusive) of row y, relative to cx,cy, clipped, and 
+ * limited to the sector if there is one */
+static void spi_oled_curve_span (SPIOled *self, int cx, int cy, int y, 
+      int x1, int x2, const CurveSector *sector, uint8_t colour)
+  {
+  if (x1 > x2) return;
+  int stride = self->target->stride;
+  int spans[2][2] = { { x1, x2 }, { 1, 0 } };
+  if (sector && !sector->reflex)
     {
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 1, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 3, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 7, colour);
+    // Clockwise of the start, anticlockwise of the end
+    curve_half_line (-sector->sy, (int64_t)sector->sx * y, 
+      &spans[0][0], &spans[0][1]);
+    curve_half_line (sector->ey, -(int64_t)sector->ex * y, 
+      &spans[0][0], &spans[0][1]);
     }
-  else if (val == 8)
+  else if (sector)
     {
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 1, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 2, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 3, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 4, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 5, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 6, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 7, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 8, colour);
+    // Cut out the part strictly clockwise of the end and anticlockwise
+    //  of the start
+    int lo = x1, hi = x2;
+    curve_half_line (-sector->ey, (int64_t)sector->ex * y - 1, &lo, &hi);
+    curve_half_line (sector->sy, -(int64_t)sector->sx * y - 1, &lo, &hi);
+    if (lo <= hi)
+      {
+      spans[0][1] = lo - 1;
+      spans[1][0] = hi + 1;
+      spans[1][1] = x2;
+      }
     }
-  else if (val == 9)
+  for (int i = 0; i < 2; i++)
     {
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 1, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 2, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 3, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 4, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 6, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 7, colour);
-    spi_oled_draw_seqment (self, x, y, width, height, thickness, 8, colour);
+    int sx1 = cx + spans[i][0];
+    int sx2 = cx + spans[i][1] + 1;
+    if (sx1 < self->clip_x1) sx1 = self->clip_x1;
+    if (sx2 > self->clip_x2) sx2 = self->clip_x2;
+    if (sx1 < sx2)
+      span_hline (self->target->buffer, stride, sx1, sx2, cy + y, colour);
     }
   }
 
 
-void spi_oled_draw_square (SPIOled *self, uint16_t x1, uint16_t y1, 
-      uint16_t length, uint8_t colour, BOOL fill)
+/* Draw the part of an ellipse of radii rx,ry inside the sector, if there
+ * is one. A filled ellipse is one span per row. An outline is, on each
+ * row, the pixels that are beyond the half-width of the next row out 
+ * -- always including the end pixels, so that steep sides are unbroken.
+ * If inner is not negative, the shape is a filled ring, with the circle 
+ * of radius inner - 1 taken out */
+static void spi_oled_curve (SPIOled *self, int cx, int cy, int rx, int ry, 
+      int inner, BOOL fill, const CurveSector *sector, uint8_t colour)
   {
-  spi_oled_draw_rect (self, x1, y1, x1 + length, y1 + length, colour, fill);
+  if (rx < 0 || ry < 0) return;
+  if (cx - rx >= self->clip_x2 || cx + rx < self->clip_x1
+       || cy - ry >= self->clip_y2 || cy + ry < self->clip_y1)
+    return;
+  CurveRows outer, next, hole;
+  curve_rows_init (&outer, rx, ry);
+  curve_rows_init (&next, rx, ry);
+  if (inner > 0) curve_rows_init (&hole, inner - 1, inner - 1);
+  for (int y = 0; y <= ry; y++)
+    {
+    int w = curve_rows_width (&outer, y);
+    int from = -1; // Half-width of the part of the row not drawn
+    if (inner > 0)
+      from = y < inner ? curve_rows_width (&hole, y) : -1;
+    else if (!fill)
+      {
+      from = y < ry ? curve_rows_width (&next, y + 1) : -1;
+      if (from >= w) from = w - 1;
+      }
+    for (int side = 0; side < (y ? 2 : 1); side++)
+      {
+      int row = side ? -y : y;
+      if (cy + row < self->clip_y1 || cy + row >= self->clip_y2) continue;
+      if (from < 0)
+        spi_oled_curve_span (self, cx, cy, row, -w, w, sector, colour);
+      else
+        {
+        spi_oled_curve_span (self, cx, cy, row, -w, -from - 1, sector, 
+          colour);
+        spi_oled_curve_span (self, cx, cy, row, from + 1, w, sector, 
+          colour);
+        }
+      }
+    }
+  spi_oled_mark_dirty_clipped (self, cx - rx, cy - ry, cx + rx + 1, 
+    cy + ry + 1);
   }
 
 
-void spi_oled_draw_line (SPIOled *self, uint16_t x1, uint16_t y1, 
-      uint16_t x2, uint16_t y2, int thickness, uint8_t colour)
+void spi_oled_draw_circle (SPIOled *self, int cx, int cy, int r, 
+      uint8_t colour, BOOL fill)
+  {
+  spi_oled_curve (self, cx, cy, r, r, -1, fill, NULL, colour);
+  }
+
+
+void spi_oled_draw_ellipse (SPIOled *self, int cx, int cy, int rx, int ry,
+      uint8_t colour, BOOL fill)
+  {
+  spi_oled_curve (self, cx, cy, rx, ry, -1, fill, NULL, colour);
+  }
+
+
+void spi_oled_draw_arc (SPIOled *self, int cx, int cy, int r, int start,
+      int end, uint8_t colour, BOOL fill)
   {
-  /*if (x1 > x2)
+  CurveSector sector;
+  if (end - start >= 360)
+    spi_oled_curve (self, cx, cy, r, r, -1, fill, NULL, colour);
+  else if (curve_sector_init (&sector, start, end))
+    spi_oled_curve (self, cx, cy, r, r, -1, fill, &sector, colour);
+  }
+
+
+void spi_oled_fill_ring (SPIOled *self, int cx, int cy, int r1, int r2, 
+      int start, int end, uint8_t colour)
+  {
+  CurveSector sector;
+  if (r1 < 0) r1 = 0;
+  if (r1 > r2) return;
+  if (end - start >= 360)
+    spi_oled_curve (self, cx, cy, r2, r2, r1, TRUE, NULL, colour);
+  else if (curve_sector_init (&sector, start, end))
+    spi_oled_curve (self, cx, cy, r2, r2, r1, TRUE, &sector, colour);
+  }
+
+
+/* An edge of a polygon being filled. At scanline y, the edge crosses the
+ * middle of the row at x0 + num / den, where num is kept up to date as
+ * y increases. Using the exact fraction means that the same edge gives
+ * the same pixels whichever polygon it belongs to */
+typedef struct _PolygonEdge
+  {
+  int y1, y2; // Scanlines covered: y1 to y2, exclusive
+  int x0, y0;
+  int64_t num, step, den;
+  int x;      // Where the current span starts or ends
+  } PolygonEdge;
+
+
+static int polygon_compare_edges (const void *a, const void *b)
+  {
+  return ((const PolygonEdge *)a)->y1 - ((const PolygonEdge *)b)->y1;
+  }
+
+
+/* ceil (a / b), for b > 0 */
+static inline int64_t polygon_ceil_div (int64_t a, int64_t b)
+  {
+  return a >= 0 ? (a + b - 1) / b : -((-a) / b);
+  }
+
+
+/* The classic active edge table. The edges are sorted by their first 
+ * scanline; at each scanline, edges that start there join the active
+ * list and edges that have ended leave it, and the active edges' 
+ * crossings, kept in order, bound the spans. So the work is in 
+ * proportion to the number of edges and spans, not to the area of the
+ * polygon's bounding box. A pixel is in the polygon if its centre is, so
+ * an edge is active on scanline y if it crosses y + 1/2, and a span 
+ * covers the pixels whose centres lie between two crossings */
+void spi_oled_fill_polygon (SPIOled *self, const SPIOledPoint *points, 
+      int n, uint8_t colour)
+  {
+  if (n < 3) return;
+  PolygonEdge local[SPI_OLED_POLYGON_EDGES];
+  PolygonEdge *edges = local;
+  PolygonEdge *active[SPI_OLED_POLYGON_EDGES];
+  PolygonEdge **act = active;
+  if (n > SPI_OLED_POLYGON_EDGES)
     {
-    int t = x1;
-    x1 = x2;
-    x2 = t;
+    edges = malloc (n * sizeof (PolygonEdge));
+    act = malloc (n * sizeof (PolygonEdge *));
+    if (!edges || !act)
+      {
+      debug_log ("Out of memory for a polygon of %d edges", n);
+      free (edges);
+      free (act);
+      return;
+      }
     }
-  if (y1 > y2)
-    {
-    int t = y1;
-    y1 = y2;
-    y2 = t;
-    }*/
-  uint16_t x = x1;
-  uint16_t y = y1;
-  int dx = x2 - x1 >= 0 ? x2 - x1: x1 - x2;
-  int dy = y2 - y1 <= 0 ? y2 - y1: y1 - y2;
-
-  int xadd = x1 < x2 ? 1 : -1;
-  int yadd = y1 < y2 ? 1 : -1;
 
-  int esp = dx + dy;
+  // The edge table, leaving out horizontal edges
+  int count = 0;
+  int bx1 = points[0].x, bx2 = points[0].x;
+  int by1 = points[0].y, by2 = points[0].y;
+  for (int i = 0; i < n; i++)
+    {
+    const SPIOledPoint *p = &points[i];
+    const SPIOledPoint *q = &points[(i + 1) % n];
+    if (p->x < bx1) bx1 = p->x;
+    if (p->x > bx2) bx2 = p->x;
+    if (p->y < by1) by1 = p->y;
+    if (p->y > by2) by2 = p->y;
+    if (p->y == q->y) continue;
+    if (p->y > q->y)
+      {
+      const SPIOledPoint *t = p;
+      p = q;
+      q = t;
+      }
+    PolygonEdge *e = &edges[count++];
+    e->x0 = p->x;
+    e->y0 = p->y;
+    e->y1 = p->y;
+    e->y2 = q->y;
+    e->step = 2 * (int64_t)(q->x - p->x);
+    e->den = 2 * (int64_t)(q->y - p->y);
+    }
+  qsort (edges, count, sizeof (PolygonEdge), polygon_compare_edges);
 
-  for (;;)
+  int y1 = by1 > self->clip_y1 ? by1 : self->clip_y1;
+  int y2 = by2 < self->clip_y2 ? by2 : self->clip_y2;
+  int stride = self->target->stride;
+  int next = 0, n_active = 0;
+  for (int y = y1; y < y2; y++)
     {
-    // It's a bit quicker to use set_pixel if the line is only
-    //  one pixel thick
-    if (thickness == 1)
-      spi_oled_set_pixel (self, x, y, colour);
-    else
-      spi_oled_draw_square (self, x, y, thickness, colour, TRUE);
-    if (2 * esp >= dy)
+    // Drop the edges that have ended, and add the ones that start here.
+    //  Edges that started above the clip rectangle are picked up on its
+    //  first row, and start part-way along
+    int kept = 0;
+    for (int i = 0; i < n_active; i++)
+      if (act[i]->y2 > y) act[kept++] = act[i];
+    n_active = kept;
+    for (; next < count && edges[next].y1 <= y; next++)
+      {
+      PolygonEdge *e = &edges[next];
+      if (e->y2 <= y) continue;
+      e->num = (2 * (int64_t)(y - e->y0) + 1) * (e->step / 2);
+      act[n_active++] = e;
+      }
+
+    // Find the crossings, and put them in order. They are nearly in 
+    //  order already, from the last scanline, so an insertion sort is
+    //  the quickest
+    for (int i = 0; i < n_active; i++)
       {
-      if (x == x2) break;
-      esp += dy;
-      x += xadd;
+      PolygonEdge *e = act[i];
+      // The first pixel whose centre is at or beyond x0 + num / den
+      e->x = polygon_ceil_div (2 * e->x0 * e->den + 2 * e->num - e->den, 
+        2 * e->den);
+      e->num += e->step;
+      int j = i;
+      while (j > 0 && act[j - 1]->x > e->x)
+        {
+        act[j] = act[j - 1];
+        j--;
+        }
+      act[j] = e;
       }
-    if (2 * esp <= dx)
+
+    for (int i = 0; i + 1 < n_active; i += 2)
       {
-      if (y == y2) break;
-      esp += dx;
-      y += yadd;
+      int sx1 = act[i]->x;
+      int sx2 = act[i + 1]->x;
+      if (sx1 < self->clip_x1) sx1 = self->clip_x1;
+      if (sx2 > self->clip_x2) sx2 = self->clip_x2;
+      if (sx1 < sx2)
+        span_hline (self->target->buffer, stride, sx1, sx2, y, colour);
       }
     }
+  spi_oled_mark_dirty_clipped (self, bx1, y1, bx2 + 1, y2);
+
+  if (edges != local)
+    {
+    free (edges);
+    free (act);
+    }
   }
 
 
+/* An outline is four spans: the top and bottom rows, and the left and 
+ * right columns between them */
 void spi_oled_draw_rect (SPIOled *self, uint16_t x1, uint16_t y1, 
       uint16_t x2, uint16_t y2, uint8_t colour, BOOL fill)
   {
-  for (int y = y1; y < y2; y++)
+  if (x1 >= x2 || y1 >= y2) return;
+  if (fill)
     {
-    for (int x = x1; x < x2; x++)
-      {
-      BOOL draw = FALSE;
-      if (fill) draw = TRUE;
-      else if (x == x1) draw = TRUE;
-      else if (x == x2 - 1) draw = TRUE;
-      else if (y == y1) draw = TRUE;
-      else if (y == y2 - 1) draw = TRUE;
-      if (draw)
-        {
-        spi_oled_set_pixel (self, x, y, colour);
-        }
-      }
+    spi_oled_fill (self, x1, y1, x2, y2, colour);
+    }
+  else
+    {
+    spi_oled_fill (self, x1, y1, x2, y1 + 1, colour);
+    spi_oled_fill (self, x1, y2 - 1, x2, y2, colour);
+    spi_oled_fill (self, x1, y1 + 1, x1 + 1, y2 - 1, colour);
+    spi_oled_fill (self, x2 - 1, y1 + 1, x2, y2 - 1, colour);
     }
   }
 
 
 /* This is the most fundamental drawing function -- set a specific pixel to
- * a specific value. All the other functions are built on this one */
+ * a specific value. Pixels outside the clip rectangle are ignored */
 void spi_oled_set_pixel (SPIOled *self, uint16_t x, uint16_t y, uint8_t colour)
   {
-  if (x >= self->width) return;
-  if (y > self->height) return;
-  int half = self->page / 2;
-  if (x % 2 == 0) 
+  if (x < self->clip_x1 || x >= self->clip_x2) return;
+  if (y < self->clip_y1 || y >= self->clip_y2) return;
+  SPIOledSurface *t = self->target;
+  if (x < t->dirty_x1) t->dirty_x1 = x & ~1;
+  if (x >= t->dirty_x2) t->dirty_x2 = (x | 1) + 1;
+  if (y < t->dirty_y1) t->dirty_y1 = y;
+  if (y >= t->dirty_y2) t->dirty_y2 = y + 1;
+  span_pixel (t->buffer, t->stride, x, y, colour);
+  }
+
+
+BOOL spi_oled_push_clip (SPIOled *self, int x1, int y1, int x2, int y2)
+  {
+  if (self->clip_depth == SPI_OLED_CLIP_DEPTH)
     {
-    //self->buffer [x / 2 + y * half] = 
-    //  (colour << 4) | self->buffer [x / 2 + y * half];
-    self->buffer [x / 2 + y * half] = 
-      (colour << 4) | (self->buffer [x / 2 + y * half] & 0x0F);
-    } 
-  else 
+    debug_log ("Clip stack is full");
+    return FALSE;
+    }
+  int *saved = self->clip_stack[self->clip_depth++];
+  saved[0] = self->clip_x1;
+  saved[1] = self->clip_y1;
+  saved[2] = self->clip_x2;
+  saved[3] = self->clip_y2;
+  if (x1 > self->clip_x1) self->clip_x1 = x1;
+  if (y1 > self->clip_y1) self->clip_y1 = y1;
+  if (x2 < self->clip_x2) self->clip_x2 = x2;
+  if (y2 < self->clip_y2) self->clip_y2 = y2;
+  // An empty clip rectangle is fine, so long as its edges are consistent
+  if (self->clip_x2 < self->clip_x1) self->clip_x2 = self->clip_x1;
+  if (self->clip_y2 < self->clip_y1) self->clip_y2 = self->clip_y1;
+  return TRUE;
+  }
+
+
+void spi_oled_pop_clip (SPIOled *self)
+  {
+  if (self->clip_depth == 0)
+    {
+    debug_log ("Clip stack is empty");
+    return;
+    }
+  int *saved = self->clip_stack[--self->clip_depth];
+  self->clip_x1 = saved[0];
+  self->clip_y1 = saved[1];
+  self->clip_x2 = saved[2];
+  self->clip_y2 = saved[3];
+  }
+
+
+/* The region is clipped to the screen, and widened to whole bytes, so 
+ * that it can be saved and restored a row at a time with memcpy() */
+BOOL spi_oled_push_region (SPIOled *self, int x1, int y1, int x2, int y2)
+  {
+  if (self->region_depth == SPI_OLED_REGION_DEPTH)
+    {
+    debug_log ("Region stack is full");
+    return FALSE;
+    }
+  int stride = self->screen.stride;
+  if (x1 < 0) x1 = 0;
+  if (y1 < 0) y1 = 0;
+  if (x2 > self->width) x2 = self->width;
+  if (y2 > self->height) y2 = self->height;
+  // An empty region is still pushed, so that pushes and pops match, but
+  //  as 0,0 to 0,0 -- widening an empty span at an odd or off-screen x 
+  //  would save a byte that isn't in it, or isn't in the row at all
+  if (x2 <= x1 || y2 <= y1) x1 = y1 = x2 = y2 = 0;
+  int bx1 = x1 / 2;
+  int bx2 = (x2 + 1) / 2;
+  int size = (bx2 - bx1) * (y2 - y1);
+  if (self->region_used + size > stride * self->height)
+    {
+    debug_log ("No room in the region stack for %d bytes", size);
+    return FALSE;
+    }
+  uint8_t *p = self->region_arena + self->region_used;
+  for (int y = y1; y < y2; y++, p += bx2 - bx1)
+    memcpy (p, self->buffer + y * stride + bx1, bx2 - bx1);
+  self->region_used += size;
+  int *saved = self->region_stack[self->region_depth++];
+  saved[0] = bx1;
+  saved[1] = y1;
+  saved[2] = bx2;
+  saved[3] = y2;
+  return TRUE;
+  }
+
+
+void spi_oled_pop_region (SPIOled *self)
+  {
+  if (self->region_depth == 0)
+    {
+    debug_log ("Region stack is empty");
+    return;
+    }
+  int *saved = self->region_stack[--self->region_depth];
+  int stride = self->screen.stride;
+  int bx1 = saved[0], y1 = saved[1], bx2 = saved[2], y2 = saved[3];
+  self->region_used -= (bx2 - bx1) * (y2 - y1);
+  const uint8_t *p = self->region_arena + self->region_used;
+  for (int y = y1; y < y2; y++, p += bx2 - bx1)
+    memcpy (self->buffer + y * stride + bx1, p, bx2 - bx1);
+  spi_oled_surface_mark_dirty (&self->screen, bx1 * 2, y1, bx2 * 2, y2);
+  }
+
+
+/* The source rectangle is clipped to the source surface, and the
+ * destination to the clip rectangle, keeping the two in step */
+void spi_oled_blit_rop (SPIOled *self, const SPIOledSurface *src, int sx,
+      int sy, int w, int h, int dx, int dy, SPIOledRop rop, uint8_t key)
+  {
+  if (src == self->target)
+    {
+    // Rows are copied forwards, so an overlapping copy would read
+    //  pixels it had already overwritten
+    debug_log ("Can't blit from the drawing target to itself");
+    return;
+    }
+  // Cut off whatever lies left of, or above, either rectangle
+  int cut = -sx > self->clip_x1 - dx ? -sx : self->clip_x1 - dx;
+  if (cut > 0)
+    {
+    sx += cut;
+    dx += cut;
+    w -= cut;
+    }
+  cut = -sy > self->clip_y1 - dy ? -sy : self->clip_y1 - dy;
+  if (cut > 0)
     {
-    //self->buffer [x / 2 + y * half] = 
-    //  (colour & 0x0f) | self->buffer [x / 2 + y * half];
-    self->buffer [x / 2 + y * half] = 
-      (colour & 0x0f) | (self->buffer [x / 2 + y * half] & 0xF0);
+    sy += cut;
+    dy += cut;
+    h -= cut;
     }
+  if (sx + w > src->width) w = src->width - sx;
+  if (sy + h > src->height) h = src->height - sy;
+  if (dx + w > self->clip_x2) w = self->clip_x2 - dx;
+  if (dy + h > self->clip_y2) h = self->clip_y2 - dy;
+  if (w <= 0 || h <= 0) return;
+  span_rop_rect (self->target->buffer, self->target->stride, dx, dy,
+    src->buffer, src->stride, sx, sy, w, h, rop, key);
+  spi_oled_mark_dirty (self, dx, dy, dx + w, dy + h);
+  }
+
+
+void spi_oled_blit (SPIOled *self, const SPIOledSurface *src, int sx,
+      int sy, int w, int h, int dx, int dy)
+  {
+  spi_oled_blit_rop (self, src, sx, sy, w, h, dx, dy, SPI_OLED_ROP_COPY, 0);
+  }
+
+
+void spi_oled_fill_rect_rop (SPIOled *self, int x1, int y1, int x2, int y2,
+      uint8_t colour, SPIOledRop rop)
+  {
+  if (x1 < self->clip_x1) x1 = self->clip_x1;
+  if (y1 < self->clip_y1) y1 = self->clip_y1;
+  if (x2 > self->clip_x2) x2 = self->clip_x2;
+  if (y2 > self->clip_y2) y2 = self->clip_y2;
+  if (x1 >= x2 || y1 >= y2) return;
+  span_fill_rect_rop (self->target->buffer, self->target->stride, x1, y1, 
+    x2, y2, colour, rop);
+  spi_oled_mark_dirty (self, x1, y1, x2, y2);
   }
 
 
@@ -378,63 +1038,238 @@ static void spi_oled_set_scan_dir (SPIOled *self, SPIOledScanDir dir)
   }
 
 
+/* Clear the drawing target. On the screen, this also means that the whole
+ * screen will be sent by the next flush */
 void spi_oled_clear (SPIOled* self, uint8_t colour)
   {
   debug_log ("Call spi_oled_clear, colour=%d", colour);
-  unsigned int i,m;
-  for (i = 0; i < self->page; i++) 
-    {
-    for (m = 0; m < (self->column / 2); m++) 
-      {
-      self->buffer [i * (self->column / 2) + m] = colour | (colour << 4);
-      }
-    }
+  SPIOledSurface *t = self->target;
+  span_fill_rect (t->buffer, t->stride, 0, 0, t->width, t->height, colour);
+  spi_oled_surface_invalidate (t);
+  }
+
+
+/* Extend the drawing target's damage rectangle to cover x1,y1 to x2,y2 
+ * (exclusive) */
+void spi_oled_mark_dirty (SPIOled *self, int x1, int y1, int x2, int y2)
+  {
+  spi_oled_surface_mark_dirty (self->target, x1, y1, x2, y2);
+  }
+
+
+void spi_oled_invalidate (SPIOled *self)
+  {
+  spi_oled_surface_invalidate (&self->screen);
   }
 
 
+void spi_oled_set_target (SPIOled *self, SPIOledSurface *surface)
+  {
+  self->target = surface ? surface : &self->screen;
+  self->clip_x1 = 0;
+  self->clip_y1 = 0;
+  self->clip_x2 = self->target->width;
+  self->clip_y2 = self->target->height;
+  self->clip_depth = 0;
+  }
+
+
+/* Set the panel's write window, in pixels. Each column address covers 
+ * two pixels, so xstart and xend must be even. If the window is the same 
+ * as the one used by the last flush, there's no need to send it again -- 
+ * the panel's address pointer wraps back to the start of the window 
+ * after the last byte in it is written */
 static void spi_oled_set_window (SPIOled *self, uint16_t xstart, 
         uint16_t ystart, uint16_t xend, uint16_t yend)	
   {
   debug_log ("Call spi_oled_set_window");
-  spi_oled_write_reg (self, 0x15);
-  spi_oled_write_reg (self, xstart);
-  spi_oled_write_reg (self, xend - 1);
+  if (self->window_valid && self->window[0] == xstart 
+       && self->window[1] == ystart && self->window[2] == xend 
+       && self->window[3] == yend)
+    return;
 
-  spi_oled_write_reg (self, 0x75);
-  spi_oled_write_reg (self, ystart);
-  spi_oled_write_reg (self, yend - 1);
+  uint8_t cmds[6] = 
+    {
+    0x15, xstart / 2, xend / 2 - 1,
+    0x75, ystart, yend - 1
+    };
+  spi_oled_write_cmds (self, cmds, sizeof (cmds));
+
+  self->window[0] = xstart;
+  self->window[1] = ystart;
+  self->window[2] = xend;
+  self->window[3] = yend;
+  self->window_valid = TRUE;
   }
 
 
-void spi_oled_flush (SPIOled* self)
+/* Send the window x1,y1 to x2,y2 (pixels, exclusive, x values even) from
+ * the frame buffer to the panel. The rows of a partial window are not 
+ * contiguous in the buffer, but spi_write_rows() still sends them in as
+ * few ioctl() calls as it can. Returns FALSE if the write failed, in 
+ * which case the panel may have any part of the window */
+static BOOL spi_oled_send_window (SPIOled *self, int x1, int y1, 
+      int x2, int y2)
   {
-  debug_log ("Call spi_oled_flush");
-  if (self->ready)
+  spi_oled_set_window (self, x1, y1, x2, y2);
+
+  gpio_set_multi (self->gpio, OLED_BIT_DC | OLED_BIT_CS, OLED_BIT_DC);
+
+  // Writes are TX-only, so the frame buffer is sent in place, 
+  //  without copying
+  int stride = self->column / 2;
+  BOOL ok = spi_write_rows (self->spi, self->buffer + y1 * stride + x1 / 2,
+        (x2 - x1) / 2, stride, y2 - y1) == 0;
+  if (!ok)
     {
-    int buff_size = self->width * self->height / 2;
-    char *saved_buff = malloc (buff_size);
-    memcpy (saved_buff, self->buffer, buff_size);
-    uint8_t *pBuf = self->buffer; 
+    // We don't know how much of the window was written, so we 
+    //  don't know where the panel's address pointer is
+    self->window_valid = FALSE;
+    }
+  gpio_set (self->gpio, OLED_LINE_CS, GPIO_HIGH);
+  return ok;
+  }
+
+
+/* Send the window bx1,y1 to bx2,y2 (byte columns, exclusive), and record
+ * that the panel now has those bytes. If the write fails, the shadow is
+ * left alone, and the window is marked as damaged again, so that the 
+ * next flush compares and resends it */
+static void spi_oled_send_shadow_window (SPIOled *self, int bx1, int y1, 
+      int bx2, int y2)
+  {
+  int stride = self->column / 2;
+  if (!spi_oled_send_window (self, bx1 * 2, y1, bx2 * 2, y2))
+    {
+    spi_oled_surface_mark_dirty (&self->screen, bx1 * 2, y1, bx2 * 2, y2);
+    return;
+    }
+  for (int y = y1; y < y2; y++)
+    kernels()->copy (self->shadow + y * stride + bx1, 
+      self->buffer + y * stride + bx1, bx2 - bx1);
+  }
 
-    spi_oled_set_window (self, 0, 0, self->column, self->page);
 
-    gpio_set_pin (OLED_DC, GPIO_HIGH);
-    gpio_set_pin (OLED_CS, GPIO_LOW);
+/* Compare the damaged part of the buffer with the shadow copy of what the
+ * panel is showing, and send only the spans that differ. Changed rows 
+ * are merged into a single window when that is cheaper than setting up a
+ * new window -- including rows that haven't changed, if the gap is 
+ * small */
+static void spi_oled_flush_diff (SPIOled *self, int x1, int y1, int x2, 
+      int y2)
+  {
+  int stride = self->column / 2;
+  int bx1 = x1 / 2;
+  int bx2 = x2 / 2;
+  int win_y1 = -1, win_y2 = 0, win_x1 = 0, win_x2 = 0;
+  int sent = 0, windows = 0;
 
-    for (int page = 0; page < self->page; page++) 
+  for (int y = y1; y < y2; y++)
+    {
+    int first, last;
+    if (!kernels()->diff (self->buffer + y * stride + bx1, 
+          self->shadow + y * stride + bx1, bx2 - bx1, &first, &last))
+      continue;
+    first += bx1;
+    last += bx1;
+
+    if (win_y1 >= 0)
+      {
+      int mx1 = first < win_x1 ? first : win_x1;
+      int mx2 = last > win_x2 ? last : win_x2;
+      int merged = (y + 1 - win_y1) * (mx2 - mx1);
+      int separate = (win_y2 - win_y1) * (win_x2 - win_x1) 
+        + SPI_OLED_WINDOW_COST + (last - first);
+      if (merged <= separate)
+        {
+        win_x1 = mx1;
+        win_x2 = mx2;
+        win_y2 = y + 1;
+        continue;
+        }
+      spi_oled_send_shadow_window (self, win_x1, win_y1, win_x2, win_y2);
+      sent += (win_y2 - win_y1) * (win_x2 - win_x1);
+      windows++;
+      }
+    win_x1 = first;
+    win_x2 = last;
+    win_y1 = y;
+    win_y2 = y + 1;
+    }
+
+  if (win_y1 >= 0)
+    {
+    spi_oled_send_shadow_window (self, win_x1, win_y1, win_x2, win_y2);
+    sent += (win_y2 - win_y1) * (win_x2 - win_x1);
+    windows++;
+    }
+
+  debug_log ("Diff flush sent %d of %d bytes in %d windows", sent, 
+    (bx2 - bx1) * (y2 - y1), windows);
+  }
+
+
+/* Send the damaged part of the frame buffer to the panel, either as a 
+ * single window, or, in SPI_OLED_FLUSH_DIFF mode, just the parts that 
+ * differ from what the panel is already showing */
+void spi_oled_flush (SPIOled* self)
+  {
+  debug_log ("Call spi_oled_flush");
+  if (self->ready)
+    {
+    int x1 = self->screen.dirty_x1;
+    int y1 = self->screen.dirty_y1;
+    int x2 = self->screen.dirty_x2;
+    int y2 = self->screen.dirty_y2;
+    if (x1 >= x2 || y1 >= y2) 
       {
-      spi_write_bytes (self->spi, pBuf, self->column / 2);
-      pBuf += self->column / 2;
+      debug_log ("Nothing to flush");
+      return;
       }
-    gpio_set_pin (OLED_CS, GPIO_HIGH);
-    memcpy (self->buffer, saved_buff, buff_size);
-    free (saved_buff);
+    debug_log ("Flushing %d,%d to %d,%d", x1, y1, x2, y2);
+
+    // Anything that fails to send is marked as damaged again
+    spi_oled_surface_clear_dirty (&self->screen);
+    if (self->flush_mode == SPI_OLED_FLUSH_DIFF)
+      spi_oled_flush_diff (self, x1, y1, x2, y2);
+    else if (!spi_oled_send_window (self, x1, y1, x2, y2))
+      spi_oled_surface_mark_dirty (&self->screen, x1, y1, x2, y2);
     }
   else
     debug_log ("Called spi_oled_flush but panel not ready");
   }
 
 
+/* Switching to diff mode needs a copy of what the panel is showing. So
+ * flush any pending changes first, after which the panel matches the
+ * frame buffer */
+void spi_oled_set_flush_mode (SPIOled *self, SPIOledFlushMode mode)
+  {
+  debug_log ("Call spi_oled_set_flush_mode, mode=%d", mode);
+  if (mode == self->flush_mode) return;
+  spi_oled_flush (self);
+  if (mode == SPI_OLED_FLUSH_DIFF)
+    {
+    int size = self->column / 2 * self->page;
+    self->shadow = malloc (size);
+    memcpy (self->shadow, self->buffer, size);
+    // If the flush failed, the panel may not have what is still marked
+    //  as damaged. Make the shadow differ there, so that it is resent
+    int stride = self->column / 2;
+    for (int y = self->screen.dirty_y1; y < self->screen.dirty_y2; y++)
+      for (int bx = self->screen.dirty_x1 / 2; 
+           bx < self->screen.dirty_x2 / 2; bx++)
+        self->shadow[y * stride + bx] ^= 0xFF;
+    }
+  else
+    {
+    free (self->shadow);
+    self->shadow = NULL;
+    }
+  self->flush_mode = mode;
+  }
+
+
 /*=========================================================================
   spi_oled_reset
   What does this do? It seems to turn the panel off, but it doesn't clear
@@ -444,35 +1279,77 @@ void spi_oled_flush (SPIOled* self)
 void spi_oled_reset (SPIOled *self)
   {
   debug_log ("Call spi_oled_reset");
-  gpio_set_pin (OLED_RST, GPIO_HIGH);
+  self->window_valid = FALSE;
+  gpio_set (self->gpio, OLED_LINE_RST, GPIO_HIGH);
   spi_oled_delay_msec (100);
-  gpio_set_pin (OLED_RST, GPIO_LOW);
+  gpio_set (self->gpio, OLED_LINE_RST, GPIO_LOW);
   spi_oled_delay_msec (100);
-  gpio_set_pin (OLED_RST, GPIO_HIGH);
+  gpio_set (self->gpio, OLED_LINE_RST, GPIO_HIGH);
   spi_oled_delay_msec (100);
   }
 
 
 
-SPIOled *spi_oled_init (const char *dev, int width, int height)
+/* Open the control lines using the specified backend. With 
+ * GPIO_BACKEND_AUTO, try the character device first, then sysfs */
+static GPIO *spi_oled_open_gpio (GPIOBackend backend)
   {
   // Set GPIO pins 8, 24, and 25, corresponding to CS, RST, and DC,
-  //   to outputs
-  if (!gpio_export (OLED_CS)) return NULL;
-  if (!gpio_export (OLED_RST)) return NULL;
-  if (!gpio_export (OLED_DC)) return NULL;
-  if (!gpio_set_direction (OLED_CS, GPIO_OUT)) return NULL;
-  if (!gpio_set_direction (OLED_RST, GPIO_OUT)) return NULL;
-  if (!gpio_set_direction (OLED_DC, GPIO_OUT)) return NULL;
+  //   to outputs, and keep them open for the life of the panel. The
+  //   order of the pins must match the OLED_LINE_XXX values
+  static const int pins[] = { OLED_CS, OLED_DC, OLED_RST };
+  int n = sizeof (pins) / sizeof (pins[0]);
+  GPIO *gpio = NULL;
+  if (backend != GPIO_BACKEND_SYSFS)
+    {
+    gpio = gpio_open_chip (OLED_GPIOCHIP, pins, n);
+    if (!gpio && backend == GPIO_BACKEND_AUTO)
+      debug_log ("Can't use %s, falling back to sysfs", OLED_GPIOCHIP);
+    }
+  if (!gpio && backend != GPIO_BACKEND_CHARDEV)
+    gpio = gpio_open (pins, n);
+  return gpio;
+  }
+
+
+SPIOled *spi_oled_init (const char *dev, int width, int height)
+  {
+  return spi_oled_init_with_backend (dev, width, height, GPIO_BACKEND_AUTO);
+  }
+
+
+SPIOled *spi_oled_init_with_backend (const char *dev, int width, int height,
+      GPIOBackend backend)
+  {
+  GPIO *gpio = spi_oled_open_gpio (backend);
+  if (!gpio) return NULL;
   SPI* spi = spi_open (dev);
   if (spi)
     {
     SPIOled *self = malloc (sizeof (SPIOled));
     self->ready = FALSE;
+    self->window_valid = FALSE;
     self->spi = spi; 
+    self->gpio = gpio;
     self->width = width;
     self->height = height;
     self->buffer = malloc (self->width / 2 * self->height);
+    self->screen.buffer = self->buffer;
+    self->screen.width = width;
+    self->screen.height = height;
+    self->screen.stride = width / 2;
+    self->target = &self->screen;
+    self->shadow = NULL;
+    self->flush_mode = SPI_OLED_FLUSH_DAMAGE;
+    self->clip_x1 = 0;
+    self->clip_y1 = 0;
+    self->clip_x2 = width;
+    self->clip_y2 = height;
+    self->clip_depth = 0;
+    self->region_arena = malloc (self->width / 2 * self->height);
+    self->region_used = 0;
+    self->region_depth = 0;
+    spi_oled_surface_clear_dirty (&self->screen);
     spi_oled_reset (self); 
     spi_oled_init_reg (self);
     spi_oled_set_scan_dir (self, SCAN_DIR_DFT);
@@ -487,6 +1364,7 @@ SPIOled *spi_oled_init (const char *dev, int width, int height)
   else
     {
     debug_log ("Can't open SPI device %s: %s", dev, strerror (errno));
+    gpio_close (gpio);
     return NULL;
     }
   }
@@ -523,10 +1401,13 @@ void spi_oled_close (SPIOled *self, BOOL panel_off)
       }
     else
       debug_log ("self->spi is null in spi_oled_close");
+    gpio_close (self->gpio);
     if (self->buffer)
       free (self->buffer);
     else
       debug_log ("self->buffer is null in spi_oled_close");
+    free (self->shadow);
+    free (self->region_arena);
     free (self);
     }
   else
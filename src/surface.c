@@ -0,0 +1,77 @@
+/*========================================================================
+  spi-oled
+  surface.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Off-screen 4bpp surfaces, and damage tracking for surfaces, including
+  the screen
+========================================================================*/
+#include <stdlib.h>
+#include <spi_oled/surface.h>
+#include <spi_oled/debug.h>
+
+SPIOledSurface *spi_oled_surface_new (int width, int height)
+  {
+  debug_log ("Call spi_oled_surface_new, width=%d, height=%d", 
+    width, height);
+  SPIOledSurface *self = malloc (sizeof (SPIOledSurface));
+  self->width = width;
+  self->height = height;
+  self->stride = (width + 1) / 2;
+  self->buffer = calloc (self->stride * height, 1);
+  spi_oled_surface_clear_dirty (self);
+  return self;
+  }
+
+
+void spi_oled_surface_free (SPIOledSurface *self)
+  {
+  if (self)
+    {
+    free (self->buffer);
+    free (self);
+    }
+  else
+    debug_log ("self is null in spi_oled_surface_free");
+  }
+
+
+/* The panel's column addresses cover two pixels each, so the rectangle's
+ * horizontal edges are always aligned to an even pixel */
+void spi_oled_surface_mark_dirty (SPIOledSurface *self, int x1, int y1, 
+      int x2, int y2)
+  {
+  if (x1 < 0) x1 = 0;
+  if (y1 < 0) y1 = 0;
+  if (x2 > self->width) x2 = self->width;
+  if (y2 > self->height) y2 = self->height;
+  if (x1 >= x2 || y1 >= y2) return;
+  x1 &= ~1;
+  x2 = (x2 + 1) & ~1;
+  if (x1 < self->dirty_x1) self->dirty_x1 = x1;
+  if (x2 > self->dirty_x2) self->dirty_x2 = x2;
+  if (y1 < self->dirty_y1) self->dirty_y1 = y1;
+  if (y2 > self->dirty_y2) self->dirty_y2 = y2;
+  }
+
+
+void spi_oled_surface_invalidate (SPIOledSurface *self)
+  {
+  self->dirty_x1 = 0;
+  self->dirty_y1 = 0;
+  self->dirty_x2 = (self->width + 1) & ~1;
+  self->dirty_y2 = self->height;
+  }
+
+
+/* The 'start' edges are beyond the 'end' edges, so any pixel that is 
+ * drawn will extend the rectangle */
+void spi_oled_surface_clear_dirty (SPIOledSurface *self)
+  {
+  self->dirty_x1 = (self->width + 1) & ~1;
+  self->dirty_y1 = self->height;
+  self->dirty_x2 = 0;
+  self->dirty_y2 = 0;
+  }
+
@@ -0,0 +1,65 @@
+/*========================================================================
+  spi-oled
+  text_field.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  A text field that redraws only the characters that have changed
+========================================================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <spi_oled/text_field.h>
+#include <spi_oled/utf8.h>
+#include <spi_oled/debug.h>
+
+TextField *text_field_new (int x, int y, const sFONT *font, int width, 
+      uint8_t fg, uint8_t bg)
+  {
+  debug_log ("Call text_field_new, x=%d, y=%d, width=%d", x, y, width);
+  TextField *self = malloc (sizeof (TextField));
+  self->x = x;
+  self->y = y;
+  self->font = font;
+  self->width = width;
+  self->fg = fg;
+  self->bg = bg;
+  self->cells = malloc (width * sizeof (uint32_t));
+  self->drawn = FALSE;
+  return self;
+  }
+
+
+void text_field_free (TextField *self)
+  {
+  if (self)
+    {
+    free (self->cells);
+    free (self);
+    }
+  else
+    debug_log ("self is null in text_field_free");
+  }
+
+
+int text_field_set (TextField *self, SPIOled *oled, const char *s)
+  {
+  int redrawn = 0;
+  for (int i = 0; i < self->width; i++)
+    {
+    uint32_t c = *s ? utf8_next (&s) : ' ';
+    if (self->drawn && self->cells[i] == c) continue;
+    spi_oled_draw_codepoint_opaque (oled, self->x + i * self->font->Width, 
+      self->y, self->font, c, self->fg, self->bg);
+    self->cells[i] = c;
+    redrawn++;
+    }
+  self->drawn = TRUE;
+  return redrawn;
+  }
+
+
+void text_field_invalidate (TextField *self)
+  {
+  self->drawn = FALSE;
+  }
+
@@ -0,0 +1,286 @@
+/*========================================================================
+  spi-oled
+  text_layout.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Laying out text into a box, with word wrap, alignment, and an
+  ellipsis when it doesn't fit. The fonts are fixed-width, so measuring
+  a line is counting its characters. Layouts are cached, so a paragraph
+  that hasn't changed is not laid out again
+========================================================================*/
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <spi_oled/text_layout.h>
+#include <spi_oled/atlas.h>
+#include <spi_oled/utf8.h>
+#include <spi_oled/debug.h>
+
+#define TEXT_ELLIPSIS 0x2026
+
+static TextLayout text_layout_cache[TEXT_LAYOUT_CACHE_SLOTS];
+
+/* FNV-1a over the string, with the rest of the key mixed in */
+static uint32_t text_layout_hash (const char *s, const sFONT *font,
+      int x, int y, int w, int h, TextAlign align)
+  {
+  uint32_t hash = 2166136261u;
+  for (; *s; s++)
+    hash = (hash ^ (uint8_t)*s) * 16777619u;
+  hash = (hash ^ (uint32_t)((uintptr_t)font >> 4)) * 16777619u;
+  hash = (hash ^ (uint32_t)(x | (y << 8))) * 16777619u;
+  hash = (hash ^ (uint32_t)(w | (h << 8))) * 16777619u;
+  hash = (hash ^ (uint32_t)align) * 16777619u;
+  return hash;
+  }
+
+
+/* Use the ellipsis character if the font has it, and three dots if not */
+static BOOL text_layout_has_ellipsis (const sFONT *font)
+  {
+  return font->atlas && atlas_glyph (font->atlas, TEXT_ELLIPSIS);
+  }
+
+
+/* Drop spaces from the end of a line */
+static void text_layout_trim (const char *s, TextLine *line)
+  {
+  while (line->length > 0 && s[line->start + line->length - 1] == ' ')
+    {
+    line->length--;
+    line->chars--;
+    }
+  }
+
+
+/* Break the text into at most 'rows' lines of at most 'cols' characters.
+ * Returns a pointer to the text that didn't fit, which is the
+ * terminating zero if it all did */
+static const char *text_layout_break (TextLayout *self, const char *s,
+      int cols, int rows)
+  {
+  const char *p = s;
+  while (*p && self->n_lines < rows)
+    {
+    const char *q = p;
+    const char *end, *next;
+    const char *space = NULL; // Start of the last space on the line
+    int space_chars = 0;
+    int chars = 0;
+    BOOL wrapped = TRUE;
+    for (;;)
+      {
+      if (!*q)
+        {
+        end = next = q;
+        break;
+        }
+      if (*q == '\n')
+        {
+        end = q;
+        next = q + 1;
+        wrapped = FALSE;
+        break;
+        }
+      if (chars == cols)
+        {
+        if (*q != ' ' && space)
+          {
+          // Break at the last space
+          end = space;
+          chars = space_chars;
+          }
+        else
+          {
+          // Either the line is full just before a space, or the word is
+          //  longer than the line -- in which case it is broken here
+          end = q;
+          }
+        next = end;
+        break;
+        }
+      if (*q == ' ')
+        {
+        space = q;
+        space_chars = chars;
+        }
+      utf8_next (&q);
+      chars++;
+      }
+
+    TextLine *line = &self->lines[self->n_lines++];
+    line->start = p - s;
+    line->length = end - p;
+    line->chars = chars;
+    line->ellipsis = FALSE;
+    text_layout_trim (s, line);
+
+    p = next;
+    if (wrapped)
+      while (*p == ' ') p++;
+    }
+  return p;
+  }
+
+
+/* Cut the last line short, and end it with an ellipsis */
+static void text_layout_ellipsize (TextLayout *self, const char *s, int cols)
+  {
+  TextLine *line = &self->lines[self->n_lines - 1];
+  int e = text_layout_has_ellipsis (self->font) ? 1 : 3;
+  if (e > cols) e = cols;
+  int keep = cols - e;
+  if (line->chars > keep)
+    {
+    const char *p = s + line->start;
+    for (int i = 0; i < keep; i++)
+      utf8_next (&p);
+    line->length = p - (s + line->start);
+    line->chars = keep;
+    }
+  text_layout_trim (s, line);
+  line->ellipsis = TRUE;
+  line->chars += e;
+  }
+
+
+static void text_layout_lay_out (TextLayout *self)
+  {
+  const sFONT *font = self->font;
+  const char *s = self->text;
+  int cols = self->box_w / font->Width;
+  int rows = self->box_h / font->Height;
+  if (rows > TEXT_LAYOUT_MAX_LINES) rows = TEXT_LAYOUT_MAX_LINES;
+
+  self->n_lines = 0;
+  if (cols > 0 && rows > 0)
+    {
+    const char *rest = text_layout_break (self, s, cols, rows);
+    if (*rest) text_layout_ellipsize (self, s, cols);
+    }
+
+  self->x1 = self->box_x + self->box_w;
+  self->x2 = self->box_x;
+  self->y1 = self->box_y;
+  self->y2 = self->box_y;
+  for (int i = 0; i < self->n_lines; i++)
+    {
+    TextLine *line = &self->lines[i];
+    int width = line->chars * font->Width;
+    switch (self->align)
+      {
+      case TEXT_ALIGN_CENTRE:
+        line->x = self->box_x + (self->box_w - width) / 2;
+        break;
+      case TEXT_ALIGN_RIGHT:
+        line->x = self->box_x + self->box_w - width;
+        break;
+      default:
+        line->x = self->box_x;
+      }
+    line->y = self->box_y + i * font->Height;
+    if (line->chars == 0) continue;
+    if (line->x < self->x1) self->x1 = line->x;
+    if (line->x + width > self->x2) self->x2 = line->x + width;
+    self->y2 = line->y + font->Height;
+    }
+  if (self->x1 >= self->x2)
+    {
+    self->x1 = self->x2 = self->box_x;
+    self->y2 = self->box_y;
+    }
+  }
+
+
+const TextLayout *text_layout (const char *s, const sFONT *font,
+      int x, int y, int w, int h, TextAlign align)
+  {
+  if (!s)
+    {
+    debug_log ("s is null in text_layout");
+    return NULL;
+    }
+  uint32_t hash = text_layout_hash (s, font, x, y, w, h, align);
+  TextLayout *self =
+    &text_layout_cache[hash % TEXT_LAYOUT_CACHE_SLOTS];
+  if (self->text && self->hash == hash && self->font == font
+       && self->box_x == x && self->box_y == y && self->box_w == w
+       && self->box_h == h && self->align == align
+       && strcmp (self->text, s) == 0)
+    return self;
+
+  free (self->text);
+  self->text = strdup (s);
+  if (!self->text)
+    {
+    // A slot with no text never matches, so nothing is cached
+    debug_log ("Out of memory for the text of a layout");
+    self->n_lines = 0;
+    return NULL;
+    }
+  self->font = font;
+  self->box_x = x;
+  self->box_y = y;
+  self->box_w = w;
+  self->box_h = h;
+  self->align = align;
+  self->hash = hash;
+  text_layout_lay_out (self);
+  return self;
+  }
+
+
+static void text_layout_draw_char (SPIOled *oled, int x, int y,
+      const sFONT *font, uint32_t c, uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  if (opaque)
+    spi_oled_draw_codepoint_opaque (oled, x, y, font, c, fg, bg);
+  else
+    spi_oled_draw_codepoint (oled, x, y, font, c, fg);
+  }
+
+
+void text_layout_draw (const TextLayout *layout, SPIOled *oled,
+      uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  if (!layout)
+    {
+    debug_log ("layout is null in text_layout_draw");
+    return;
+    }
+  const sFONT *font = layout->font;
+  for (int i = 0; i < layout->n_lines; i++)
+    {
+    const TextLine *line = &layout->lines[i];
+    const char *p = layout->text + line->start;
+    const char *end = p + line->length;
+    int x = line->x;
+    while (p < end)
+      {
+      text_layout_draw_char (oled, x, line->y, font, utf8_next (&p),
+        fg, bg, opaque);
+      x += font->Width;
+      }
+    if (line->ellipsis)
+      {
+      BOOL single = text_layout_has_ellipsis (font);
+      for (int end_x = line->x + line->chars * font->Width;
+           x < end_x; x += font->Width)
+        text_layout_draw_char (oled, x, line->y, font,
+          single ? TEXT_ELLIPSIS : '.', fg, bg, opaque);
+      }
+    }
+  }
+
+
+void text_layout_cache_clear (void)
+  {
+  debug_log ("Call text_layout_cache_clear");
+  for (int i = 0; i < TEXT_LAYOUT_CACHE_SLOTS; i++)
+    {
+    free (text_layout_cache[i].text);
+    memset (&text_layout_cache[i], 0, sizeof (TextLayout));
+    }
+  }
+
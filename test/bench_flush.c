@@ -0,0 +1,104 @@
+/*========================================================================
+  spi-oled
+  bench_flush.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Compares the two flush modes on the redraw pattern of test.c -- a
+  clock that ticks once a second, in a text field, with the date and 
+  temperature redrawn once a minute. For each mode it reports the bytes
+  sent per frame, and the CPU time that flush() takes with an SPI 
+  transfer that costs nothing. The difference in CPU time is the cost
+  of the diff, which is set against the SPI time that it saves at the
+  library's 2MHz clock
+========================================================================*/
+#include <stdio.h>
+#include <time.h>
+#include <spi_oled/spi_oled.h>
+#include <spi_oled/text_field.h>
+#include "fake_panel.h"
+
+#define SPI_HZ 2000000
+#define MINUTES 50
+
+static double now_usec (void)
+  {
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+  }
+
+
+/* Replay MINUTES minutes of test.c's main loop, without the sleep, and 
+ * return the time spent in spi_oled_flush() */
+static double replay (SPIOled *so, long *frames)
+  {
+  TextField *time_field = text_field_new (5, 5, &Font20, 8, 
+    COLOUR_WHITE, COLOUR_BLACK);
+  double flush_usec = 0;
+  *frames = 0;
+  for (int t = 0; t < MINUTES * 60; t++)
+    {
+    char tbuff[16];
+    snprintf (tbuff, sizeof (tbuff), "%02d:%02d:%02d", 12 + t / 3600, 
+      t / 60 % 60, t % 60);
+    if (t % 60 == 0)
+      {
+      char date[16];
+      snprintf (date, sizeof (date), "Sat Oct %2d", 1 + t / 60 % 28);
+      spi_oled_draw_string_opaque (so, 29, 25, &Font12, date, 3,
+        COLOUR_BLACK);
+      spi_oled_draw_rect (so, 20, 44, 20 + 85 + 2, 49 + 25 + 2, 
+        COLOUR_WHITE, FALSE);
+      spi_oled_draw_rect (so, 21, 45, 21 + 85, 50 + 25, 1, TRUE);
+      char temp_string[10];
+      snprintf (temp_string, sizeof (temp_string), "%3d C", 
+        40 + t / 60 % 3);
+      spi_oled_draw_string (so, 21, 50, &Font24, temp_string, 
+        COLOUR_BLACK);
+      spi_oled_draw_string (so, 80, 50, &Font12, "o", COLOUR_BLACK);
+      }
+    text_field_set (time_field, so, tbuff);
+    double start = now_usec ();
+    spi_oled_flush (so);
+    flush_usec += now_usec () - start;
+    (*frames)++;
+    }
+  text_field_free (time_field);
+  return flush_usec;
+  }
+
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (128, 128);
+  if (!so)
+    {
+    fprintf (stderr, "Can't make the fake panel\n");
+    return 1;
+    }
+
+  double usec[2], bytes[2];
+  const char *names[2] = { "damage", "diff" };
+  for (int mode = 0; mode < 2; mode++)
+    {
+    spi_oled_set_flush_mode (so, mode == 0 
+      ? SPI_OLED_FLUSH_DAMAGE : SPI_OLED_FLUSH_DIFF);
+    spi_oled_clear (so, COLOUR_BLACK);
+    spi_oled_flush (so);
+    long frames;
+    fake_spi_bytes = 0;
+    usec[mode] = replay (so, &frames) / frames;
+    bytes[mode] = (double)fake_spi_bytes / frames;
+    printf ("%-6s: %7.1f bytes/frame, flush CPU %6.2f us/frame, "
+      "SPI %7.1f us/frame\n", names[mode], bytes[mode], usec[mode],
+      bytes[mode] * 8 * 1e6 / SPI_HZ);
+    }
+
+  double saved = (bytes[0] - bytes[1]) * 8 * 1e6 / SPI_HZ;
+  printf ("The diff costs %.2f us of CPU per frame, and saves %.1f us "
+    "of SPI time\n", usec[1] - usec[0], saved);
+  fake_panel_free (so);
+  return 0;
+  }
+
@@ -0,0 +1,131 @@
+/*========================================================================
+  spi-oled
+  bench_text.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Compares the cost of anti-aliased text (Font12AA) with that of the
+  1bpp fonts it is made from (Font24) and sits beside (Font12). For
+  each font it reports the CPU time per glyph, drawn transparently over
+  a grey background and opaquely, at even and odd x positions.
+
+  It also writes a PGM image, bench_text.pgm unless another name is
+  given, of the same text in Font12 and Font12AA, over black and over
+  grey, magnified four times, so that the quality can be compared
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <spi_oled/spi_oled.h>
+#include "fake_panel.h"
+
+#define WIDTH  128
+#define HEIGHT 64
+#define PASSES 2000
+#define ZOOM   4
+
+static const char *bench_text = "The quick brown fox";
+
+static double now_usec (void)
+  {
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+  }
+
+
+/* Time drawing the sample text in 'font', starting at x = 0 and x = 1
+ * in turn, and return the time per glyph in microseconds */
+static double time_glyphs (SPIOled *so, const sFONT *font, BOOL opaque)
+  {
+  int n = strlen (bench_text);
+  double start = now_usec ();
+  for (int i = 0; i < PASSES; i++)
+    {
+    // Not timed separately: the fill is small beside the text
+    spi_oled_clear (so, 5);
+    int y = (i * 7) % (HEIGHT - font->Height);
+    if (opaque)
+      spi_oled_draw_string_opaque (so, i & 1, y, font, bench_text, 15, 5);
+    else
+      spi_oled_draw_string (so, i & 1, y, font, bench_text, 15);
+    }
+  double total = now_usec () - start;
+
+  // Take off the time for the clears on their own
+  start = now_usec ();
+  for (int i = 0; i < PASSES; i++)
+    spi_oled_clear (so, 5);
+  total -= now_usec () - start;
+
+  // Only the glyphs that start on the screen are drawn
+  int on_screen = (WIDTH + font->Width - 1) / font->Width;
+  int drawn = on_screen < n ? on_screen : n;
+  return total / PASSES / drawn;
+  }
+
+
+/* Write the screen of so as a PGM image, each pixel a ZOOM x ZOOM
+ * square */
+static int write_pgm (SPIOled *so, const char *filename)
+  {
+  FILE *f = fopen (filename, "wb");
+  if (!f) return -1;
+  fprintf (f, "P5\n%d %d\n255\n", WIDTH * ZOOM, HEIGHT * ZOOM);
+  for (int y = 0; y < HEIGHT * ZOOM; y++)
+    for (int x = 0; x < WIDTH * ZOOM; x++)
+      {
+      uint8_t b = so->buffer[y / ZOOM * WIDTH / 2 + x / ZOOM / 2];
+      uint8_t level = (x / ZOOM) & 1 ? b & 0x0F : b >> 4;
+      fputc (level * 17, f);
+      }
+  fclose (f);
+  return 0;
+  }
+
+
+int main (int argc, char **argv)
+  {
+  const char *filename = argc > 1 ? argv[1] : "bench_text.pgm";
+  SPIOled *so = fake_panel_new (WIDTH, HEIGHT);
+  if (!so)
+    {
+    fprintf (stderr, "Can't make the fake panel\n");
+    return 1;
+    }
+
+  const sFONT *fonts[] = { &Font12, &Font24, &Font12AA };
+  const char *names[] = { "Font12", "Font24", "Font12AA" };
+  double usec[3][2];
+  for (int f = 0; f < 3; f++)
+    {
+    usec[f][0] = time_glyphs (so, fonts[f], FALSE);
+    usec[f][1] = time_glyphs (so, fonts[f], TRUE);
+    printf ("%-8s (%2dx%2d): %6.3f us/glyph transparent, "
+      "%6.3f us/glyph opaque\n", names[f], fonts[f]->Width,
+      fonts[f]->Height, usec[f][0], usec[f][1]);
+    }
+  printf ("Font12AA costs %.1fx Font12 transparent, %.1fx opaque\n",
+    usec[2][0] / usec[0][0], usec[2][1] / usec[0][1]);
+
+  // Font12 above Font12AA, over black on the left and grey on the right
+  spi_oled_clear (so, COLOUR_BLACK);
+  spi_oled_draw_rect (so, WIDTH / 2, 0, WIDTH, HEIGHT, 6, TRUE);
+  for (int i = 0; i < 2; i++)
+    {
+    int x = i * WIDTH / 2 + 2;
+    spi_oled_draw_string (so, x, 4, &Font12, "Quick", 15);
+    spi_oled_draw_string (so, x, 18, &Font12AA, "Quick", 15);
+    spi_oled_draw_string (so, x, 34, &Font12, "fox 42", 15);
+    spi_oled_draw_string (so, x, 48, &Font12AA, "fox 42", 15);
+    }
+  if (write_pgm (so, filename) == 0)
+    printf ("Wrote %s: Font12 above Font12AA, over black and grey\n",
+      filename);
+  else
+    fprintf (stderr, "Can't write %s\n", filename);
+
+  fake_panel_free (so);
+  return 0;
+  }
+
@@ -0,0 +1,97 @@
+/*========================================================================
+  spi-oled
+  check.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Helpers shared by the check programs. Each check prints what failed,
+  and exits non-zero if anything did, so that 'make check' stops
+========================================================================*/
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+
+static int check_failures = 0;
+
+// Count and report a failure, but carry on, so that one run shows 
+//  everything that is wrong. Only the first few failures are printed
+#define CHECK(cond, ...) \
+  do { \
+    if (!(cond)) \
+      { \
+      if (check_failures++ < 10) \
+        { \
+        printf ("%s:%d: ", __FILE__, __LINE__); \
+        printf (__VA_ARGS__); \
+        printf ("\n"); \
+        } \
+      } \
+  } while (0)
+
+// Print a summary, and return the exit status for main()
+static inline int check_done (const char *name)
+  {
+  if (check_failures)
+    printf ("%s: %d failures\n", name, check_failures);
+  else
+    printf ("%s: ok\n", name);
+  return check_failures ? 1 : 0;
+  }
+
+
+// Simple LCG, so that a failure can be repeated
+static unsigned check_seed = 1;
+
+static inline int check_random (int n)
+  {
+  check_seed = check_seed * 1103515245 + 12345;
+  return (check_seed >> 16) % n;
+  }
+
+
+// The clip rectangle of the last check_random_screen(), x2 and y2 
+//  exclusive
+static int check_clip[4];
+
+// Fill the screen of so with random pixels, and copy them to 'copy', 
+//  where the reference drawing is done. Then push a random clip 
+//  rectangle -- half the time, the whole screen -- which the caller
+//  must pop
+static inline void check_random_screen (SPIOled *so, uint8_t *copy)
+  {
+  int size = so->screen.stride * so->height;
+  for (int i = 0; i < size; i++)
+    so->buffer[i] = check_random (256);
+  memcpy (copy, so->buffer, size);
+  check_clip[0] = check_clip[1] = 0;
+  check_clip[2] = so->width;
+  check_clip[3] = so->height;
+  if (check_random (2))
+    {
+    check_clip[0] = check_random (so->width);
+    check_clip[1] = check_random (so->height);
+    check_clip[2] = check_clip[0] + 1 + check_random (so->width);
+    check_clip[3] = check_clip[1] + 1 + check_random (so->height);
+    if (check_clip[2] > so->width) check_clip[2] = so->width;
+    if (check_clip[3] > so->height) check_clip[3] = so->height;
+    }
+  spi_oled_push_clip (so, check_clip[0], check_clip[1], check_clip[2],
+    check_clip[3]);
+  }
+
+
+// Set pixel x,y of a copy of the screen of so, the simplest way there
+//  is, if it is within check_clip
+static inline void check_pixel (const SPIOled *so, uint8_t *copy, int x, 
+      int y, uint8_t colour)
+  {
+  if (x < check_clip[0] || y < check_clip[1] || x >= check_clip[2]
+      || y >= check_clip[3])
+    return;
+  uint8_t *p = &copy[y * so->screen.stride + x / 2];
+  *p = x & 1 ? (*p & 0xF0) | colour : (*p & 0x0F) | (colour << 4);
+  }
+
@@ -0,0 +1,176 @@
+/*========================================================================
+  spi-oled
+  check_atlas.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks the glyph atlases that tools/fontc generates against the font
+  tables they were made from. Every character of every built-in font is
+  drawn from its atlas, and again from the original 1bpp table -- which
+  the library still draws for fonts that have no atlas -- at random
+  positions, with random clip rectangles and colours, over a random
+  screen, and the two screens must match exactly. Font12AA is checked
+  against a direct calculation of the coverage of each pixel from
+  Font24's table
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+#include "fake_panel.h"
+#include "check.h"
+
+// The tables, under other names, so as not to clash with the library's
+//  fonts, which are now atlases
+#define Font8 Ref_Font8
+#include "../fonts/font8.c"
+#undef Font8
+#define Font12 Ref_Font12
+#include "../fonts/font12.c"
+#undef Font12
+#define Font16 Ref_Font16
+#include "../fonts/font16.c"
+#undef Font16
+#define Font20 Ref_Font20
+#include "../fonts/font20.c"
+#undef Font20
+#define Font24 Ref_Font24
+#include "../fonts/font24.c"
+#undef Font24
+
+#define WIDTH  128
+#define HEIGHT 64
+#define TRIALS 20
+
+static uint8_t start[WIDTH / 2 * HEIGHT];
+static uint8_t expected[WIDTH / 2 * HEIGHT];
+
+static uint8_t get_pixel (const uint8_t *buffer, int x, int y)
+  {
+  uint8_t b = buffer[y * WIDTH / 2 + x / 2];
+  return x & 1 ? b & 0x0F : b >> 4;
+  }
+
+
+static void check_draw (SPIOled *so, int x, int y, const sFONT *font,
+      uint32_t c, uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  if (opaque)
+    spi_oled_draw_codepoint_opaque (so, x, y, font, c, fg, bg);
+  else
+    spi_oled_draw_codepoint (so, x, y, font, c, fg);
+  }
+
+
+/* Draw c from the atlas font, and from the table font, in the same
+ * circumstances */
+static void check_glyph (SPIOled *so, const sFONT *font,
+      const sFONT *ref, uint32_t c)
+  {
+  for (int i = 0; i < TRIALS; i++)
+    {
+    check_random_screen (so, start);
+    int x = check_random (WIDTH), y = check_random (HEIGHT);
+    uint8_t fg = check_random (16), bg = check_random (16);
+    BOOL opaque = check_random (2);
+    check_draw (so, x, y, ref, c, fg, bg, opaque);
+    memcpy (expected, so->buffer, sizeof (expected));
+    memcpy (so->buffer, start, sizeof (start));
+    check_draw (so, x, y, font, c, fg, bg, opaque);
+    spi_oled_pop_clip (so);
+    CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+      "%dx%d: U+%04X at %d,%d, clip %d,%d-%d,%d, %s, differs",
+      font->Width, font->Height, c, x, y, check_clip[0], check_clip[1],
+      check_clip[2], check_clip[3], opaque ? "opaque" : "transparent");
+    }
+  }
+
+
+/* Is pixel x,y of character c of a 1bpp table font inked? Pixels outside
+ * the cell aren't */
+static BOOL ref_inked (const sFONT *font, uint32_t c, int x, int y)
+  {
+  if (x >= font->Width || y >= font->Height) return FALSE;
+  int bytes_per_row = (font->Width + 7) / 8;
+  const uint8_t *row = font->table
+    + ((c - ' ') * font->Height + y) * bytes_per_row;
+  return (row[x / 8] & (0x80 >> (x % 8))) != 0;
+  }
+
+
+/* Draw c of the anti-aliased font into 'expected' the long way: each
+ * pixel's coverage is the rounded average of a 2x2 block of Font24, and
+ * the pixel is blended between fg and what is under it */
+static void ref_draw_aa (const SPIOled *so, int x, int y, uint32_t c,
+      uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  const sFONT *font = &Font12AA;
+  for (int row = 0; row < font->Height; row++)
+    for (int column = 0; column < font->Width; column++)
+      {
+      int px = x + column, py = y + row;
+      if (px >= WIDTH || py >= HEIGHT) continue;
+      int sum = 0;
+      for (int i = 0; i < 4; i++)
+        if (ref_inked (&Ref_Font24, c, column * 2 + i % 2, row * 2 + i / 2))
+          sum += 15;
+      int a = (sum + 2) / 4;
+      uint8_t under = opaque ? bg : get_pixel (expected, px, py);
+      if (a || opaque)
+        check_pixel (so, expected, px, py, 
+          (fg * a + under * (15 - a) + 7) / 15);
+      }
+  }
+
+
+static void check_glyph_aa (SPIOled *so, uint32_t c)
+  {
+  for (int i = 0; i < TRIALS; i++)
+    {
+    check_random_screen (so, expected);
+    int x = check_random (WIDTH), y = check_random (HEIGHT);
+    uint8_t fg = check_random (16), bg = check_random (16);
+    BOOL opaque = check_random (2);
+    ref_draw_aa (so, x, y, c, fg, bg, opaque);
+    check_draw (so, x, y, &Font12AA, c, fg, bg, opaque);
+    spi_oled_pop_clip (so);
+    CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+      "Font12AA: '%c' at %d,%d, clip %d,%d-%d,%d, %s, differs",
+      c, x, y, check_clip[0], check_clip[1], check_clip[2], check_clip[3],
+      opaque ? "opaque" : "transparent");
+    }
+  }
+
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (WIDTH, HEIGHT);
+  CHECK (so != NULL, "Can't make the fake panel");
+  if (!so) return check_done ("check_atlas");
+
+  const sFONT *fonts[] = { &Font8, &Font12, &Font16, &Font20, &Font24 };
+  const sFONT *refs[] = { &Ref_Font8, &Ref_Font12, &Ref_Font16,
+    &Ref_Font20, &Ref_Font24 };
+  // Characters that neither has are drawn as blank cells
+  const uint32_t missing[] = { 0x01, 0x1F, 0x7F, 0xE9, 0x263A };
+  for (int f = 0; f < 5; f++)
+    {
+    CHECK (fonts[f]->table == NULL && fonts[f]->atlas != NULL,
+      "Font %d is not an atlas", fonts[f]->Height);
+    CHECK (fonts[f]->Width == refs[f]->Width
+      && fonts[f]->Height == refs[f]->Height,
+      "Font %d is the wrong size", fonts[f]->Height);
+    for (uint32_t c = ' '; c <= '~'; c++)
+      check_glyph (so, fonts[f], refs[f], c);
+    for (int i = 0; i < 5; i++)
+      check_glyph (so, fonts[f], refs[f], missing[i]);
+    }
+
+  CHECK (Font12AA.Width == 9 && Font12AA.Height == 12,
+    "Font12AA is the wrong size");
+  for (uint32_t c = ' '; c <= '~'; c++)
+    check_glyph_aa (so, c);
+
+  fake_panel_free (so);
+  return check_done ("check_atlas");
+  }
+
@@ -0,0 +1,142 @@
+/*========================================================================
+  spi-oled
+  check_blit.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks blits and raster-op fills, which work a byte at a time, against
+  the same operations done a pixel at a time. The source surfaces, and
+  the source and destination rectangles, are random, including odd
+  sizes and positions, and rectangles that hang off either surface.
+  Also checks that blitting the drawing target to itself draws nothing
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+#include "fake_panel.h"
+#include "check.h"
+
+#define SIZE   128
+#define TRIALS 20000
+
+static uint8_t expected[SIZE / 2 * SIZE];
+
+static uint8_t get_pixel (const uint8_t *buffer, int stride, int x, int y)
+  {
+  uint8_t b = buffer[y * stride + x / 2];
+  return x & 1 ? b & 0x0F : b >> 4;
+  }
+
+
+static uint8_t ref_rop (uint8_t d, uint8_t s, SPIOledRop rop, int key)
+  {
+  switch (rop)
+    {
+    case SPI_OLED_ROP_XOR: return d ^ s;
+    case SPI_OLED_ROP_OR: return d | s;
+    case SPI_OLED_ROP_AND: return d & s;
+    case SPI_OLED_ROP_KEY: return s == key ? d : s;
+    default: return s;
+    }
+  }
+
+
+static void check_blit_rop (SPIOled *so, int trial)
+  {
+  int w = 1 + check_random (70), h = 1 + check_random (40);
+  SPIOledSurface *src = spi_oled_surface_new (w, h);
+  for (int i = 0; i < src->stride * h; i++)
+    src->buffer[i] = check_random (256);
+  int sx = check_random (w + 10) - 5, sy = check_random (h + 10) - 5;
+  int bw = check_random (80) - 3, bh = check_random (50) - 3;
+  int dx = check_random (SIZE + 22) - 11, dy = check_random (SIZE + 22) - 11;
+  SPIOledRop rop = check_random (5);
+  uint8_t key = check_random (16);
+
+  check_random_screen (so, expected);
+  spi_oled_blit_rop (so, src, sx, sy, bw, bh, dx, dy, rop, key);
+  spi_oled_pop_clip (so);
+  for (int y = 0; y < bh; y++)
+    for (int x = 0; x < bw; x++)
+      {
+      if (sx + x < 0 || sy + y < 0 || sx + x >= w || sy + y >= h
+          || dx + x < 0 || dy + y < 0 || dx + x >= SIZE || dy + y >= SIZE)
+        continue;
+      uint8_t s = get_pixel (src->buffer, src->stride, sx + x, sy + y);
+      uint8_t d = get_pixel (expected, SIZE / 2, dx + x, dy + y);
+      check_pixel (so, expected, dx + x, dy + y, ref_rop (d, s, rop, key));
+      }
+  CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+    "trial %d: blit %dx%d at %d,%d of a %dx%d surface to %d,%d, rop %d, "
+    "differs", trial, bw, bh, sx, sy, w, h, dx, dy, rop);
+  spi_oled_surface_free (src);
+  }
+
+
+static void check_fill_rop (SPIOled *so, int trial)
+  {
+  int x1 = check_random (SIZE + 22) - 11, y1 = check_random (SIZE + 22) - 11;
+  int x2 = check_random (SIZE + 22) - 11, y2 = check_random (SIZE + 22) - 11;
+  SPIOledRop rop = check_random (5);
+  uint8_t colour = check_random (16);
+
+  check_random_screen (so, expected);
+  spi_oled_fill_rect_rop (so, x1, y1, x2, y2, colour, rop);
+  spi_oled_pop_clip (so);
+  // KEY is treated as COPY, so no colour is transparent
+  if (rop == SPI_OLED_ROP_KEY) rop = SPI_OLED_ROP_COPY;
+  for (int y = y1 < 0 ? 0 : y1; y < y2 && y < SIZE; y++)
+    for (int x = x1 < 0 ? 0 : x1; x < x2 && x < SIZE; x++)
+      check_pixel (so, expected, x, y,
+        ref_rop (get_pixel (expected, SIZE / 2, x, y), colour, rop, -1));
+  CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+    "trial %d: fill %d,%d to %d,%d, rop %d, differs", trial, x1, y1, x2,
+    y2, rop);
+  }
+
+
+/* Blitting the target to itself must leave it, and its damage, alone */
+static void check_self_blit (SPIOled *so, SPIOledSurface *target,
+      const char *name)
+  {
+  spi_oled_set_target (so, target);
+  target = so->target;
+  int size = target->stride * target->height;
+  for (int i = 0; i < size; i++)
+    target->buffer[i] = check_random (256);
+  uint8_t before[SIZE / 2 * SIZE];
+  memcpy (before, target->buffer, size);
+  spi_oled_surface_clear_dirty (target);
+  spi_oled_blit (so, target, 0, 0, 20, 20, 1, 1);
+  spi_oled_blit_rop (so, target, 3, 0, 20, 20, 0, 0, SPI_OLED_ROP_XOR, 0);
+  CHECK (memcmp (before, target->buffer, size) == 0,
+    "%s: a blit to itself changed it", name);
+  CHECK (target->dirty_x1 >= target->dirty_x2,
+    "%s: a blit to itself marked damage", name);
+  spi_oled_set_target (so, NULL);
+  }
+
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (SIZE, SIZE);
+  CHECK (so != NULL, "Can't make the fake panel");
+  if (!so) return check_done ("check_blit");
+
+  for (int i = 0; i < TRIALS; i++)
+    {
+    if (i & 1)
+      check_blit_rop (so, i);
+    else
+      check_fill_rop (so, i);
+    }
+
+  SPIOledSurface *surface = spi_oled_surface_new (37, 23);
+  check_self_blit (so, NULL, "screen");
+  check_self_blit (so, surface, "surface");
+  spi_oled_surface_free (surface);
+
+  fake_panel_free (so);
+  return check_done ("check_blit");
+  }
+
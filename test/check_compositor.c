@@ -0,0 +1,149 @@
+/*========================================================================
+  spi-oled
+  check_compositor.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks that incremental compositing gives the same screen as building
+  every pixel from scratch. Random stacks of layers -- opaque, keyed and
+  translucent, on and off the screen -- are drawn on, moved, and have
+  their transparency changed at random, and after each composite the
+  screen is compared with a full per-pixel composite of the layers over
+  the background. The screen starts out with random contents, so any
+  part that the compositor never fills shows up. Finally, a composite
+  with nothing changed must not touch the screen
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+#include <spi_oled/compositor.h>
+#include "fake_panel.h"
+#include "check.h"
+
+#define SIZE   128
+#define STACKS 300
+#define STEPS  30
+
+static uint8_t expected[SIZE / 2 * SIZE];
+
+static uint8_t get_pixel (const uint8_t *buffer, int stride, int x, int y)
+  {
+  uint8_t b = buffer[y * stride + x / 2];
+  return x & 1 ? b & 0x0F : b >> 4;
+  }
+
+
+static void set_pixel (uint8_t *buffer, int x, int y, uint8_t colour)
+  {
+  uint8_t *p = &buffer[y * SIZE / 2 + x / 2];
+  *p = x & 1 ? (*p & 0xF0) | colour : (*p & 0x0F) | (colour << 4);
+  }
+
+
+/* Composite every pixel of the screen from the bottom layer up, into
+ * 'expected' */
+static void ref_composite (const Compositor *c)
+  {
+  for (int y = 0; y < SIZE; y++)
+    for (int x = 0; x < SIZE; x++)
+      {
+      int v = c->background;
+      for (int i = 0; i < c->n_layers; i++)
+        {
+        const CompositorLayer *l = &c->layers[i];
+        const SPIOledSurface *s = l->surface;
+        int lx = x - l->x, ly = y - l->y;
+        if (lx < 0 || ly < 0 || lx >= s->width || ly >= s->height) continue;
+        int p = get_pixel (s->buffer, s->stride, lx, ly);
+        if (p == l->key) continue;
+        v = (p * l->alpha + v * (15 - l->alpha) + 7) / 15;
+        }
+      set_pixel (expected, x, y, v);
+      }
+  }
+
+
+static int random_key (void)
+  {
+  return check_random (2) ? COMPOSITOR_NO_KEY : check_random (16);
+  }
+
+
+static void check_stack (SPIOled *so, int stack)
+  {
+  for (int i = 0; i < (int)sizeof (expected); i++)
+    so->buffer[i] = check_random (256);
+
+  Compositor *c = compositor_new (check_random (16));
+  int n = 1 + check_random (COMPOSITOR_MAX_LAYERS - 1);
+  if (check_random (2))
+    {
+    // A full-screen opaque bottom layer, which hides the background
+    compositor_add_layer (c, 0, 0, SIZE, SIZE, COMPOSITOR_NO_KEY, 15);
+    n--;
+    }
+  for (int i = 0; i < n; i++)
+    compositor_add_layer (c, check_random (SIZE + 20) - 10,
+      check_random (SIZE + 20) - 10, 1 + check_random (90),
+      1 + check_random (90), random_key (),
+      check_random (3) ? 15 : check_random (16));
+
+  for (int step = 0; step < STEPS; step++)
+    {
+    CompositorLayer *l = &c->layers[check_random (c->n_layers)];
+    switch (check_random (4))
+      {
+      case 0:
+        spi_oled_set_target (so, l->surface);
+        spi_oled_fill_rect_rop (so, check_random (90) - 5,
+          check_random (90) - 5, check_random (90), check_random (90),
+          check_random (16), check_random (4));
+        spi_oled_draw_circle (so, check_random (60), check_random (60),
+          check_random (20), check_random (16), check_random (2));
+        spi_oled_set_target (so, NULL);
+        break;
+      case 1:
+        compositor_move_layer (c, l, check_random (SIZE + 20) - 10,
+          check_random (SIZE + 20) - 10);
+        break;
+      case 2:
+        compositor_set_blend (c, l, random_key (), check_random (16));
+        break;
+      default:
+        break;
+      }
+    if (check_random (3) == 0 || step == STEPS - 1)
+      {
+      compositor_composite (c, so);
+      ref_composite (c);
+      CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+        "stack %d, step %d: %d layers, background %d, differs", stack,
+        step, c->n_layers, c->background);
+      }
+    }
+  compositor_free (c);
+  }
+
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (SIZE, SIZE);
+  CHECK (so != NULL, "Can't make the fake panel");
+  if (!so) return check_done ("check_compositor");
+
+  for (int i = 0; i < STACKS; i++)
+    check_stack (so, i);
+
+  Compositor *c = compositor_new (0);
+  compositor_add_layer (c, 10, 10, 20, 20, COMPOSITOR_NO_KEY, 15);
+  compositor_composite (c, so);
+  spi_oled_surface_clear_dirty (&so->screen);
+  compositor_composite (c, so);
+  CHECK (so->screen.dirty_x1 >= so->screen.dirty_x2,
+    "An unchanged composite marked damage");
+  compositor_free (c);
+
+  fake_panel_free (so);
+  return check_done ("check_compositor");
+  }
+
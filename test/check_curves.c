@@ -0,0 +1,138 @@
+/*========================================================================
+  spi-oled
+  check_curves.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks circles, ellipses, arcs and rings against a direct definition
+  of which pixels they cover, tested pixel by pixel:
+
+  - A pixel x,y from the centre is inside an ellipse of radii rx,ry if
+    it is inside the ellipse of radii rx + 1/2, ry + 1/2, so that each
+    row of a filled shape is a symmetric span.
+  - The outline is the pixels of the filled shape that are beyond the
+    half-width of the next row out, so that it has no gaps.
+  - Arcs and rings keep the pixels whose direction from the centre lies
+    between the start and end angles, using the library's sine table
+    scale of 16384, so that the edges agree exactly.
+
+  The shapes are random, centred on and off the screen, with random
+  clip rectangles
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <spi_oled/spi_oled.h>
+#include "fake_panel.h"
+#include "check.h"
+
+#define SIZE   128
+#define TRIALS 10000
+
+static uint8_t expected[SIZE / 2 * SIZE];
+
+static BOOL ref_in_ellipse (int x, int y, int rx, int ry)
+  {
+  if (rx < 0 || ry < 0) return FALSE;
+  long long a = (2LL * rx + 1) * (2 * rx + 1);
+  long long b = (2LL * ry + 1) * (2 * ry + 1);
+  return 4LL * x * x * b + 4LL * y * y * a <= a * b;
+  }
+
+
+/* The half-width of row y of the filled ellipse, or -1 if the row is
+ * empty */
+static int ref_half_width (int y, int rx, int ry)
+  {
+  for (int x = rx; x >= 0; x--)
+    if (ref_in_ellipse (x, y, rx, ry)) return x;
+  return -1;
+  }
+
+
+static long long ref_sin (int degrees)
+  {
+  return lround (sin (degrees * M_PI / 180) * 16384);
+  }
+
+
+/* Is the direction of x,y between 'start' and 'end' degrees, clockwise
+ * from 3 o'clock? y is downwards, so clockwise on the screen is the
+ * positive direction */
+static BOOL ref_in_sector (int x, int y, int start, int end)
+  {
+  if (end - start >= 360) return TRUE;
+  if (end <= start) return FALSE;
+  long long sx = ref_sin (start + 90), sy = ref_sin (start);
+  long long ex = ref_sin (end + 90), ey = ref_sin (end);
+  if (end - start <= 180)
+    return sx * y - sy * x >= 0 && x * ey - y * ex >= 0;
+  return !(ex * y - ey * x > 0 && x * sy - y * sx > 0);
+  }
+
+
+enum { CIRCLE, ELLIPSE, ARC, RING, KINDS };
+
+static const char *kinds[] = { "circle", "ellipse", "arc", "ring" };
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (SIZE, SIZE);
+  CHECK (so != NULL, "Can't make the fake panel");
+  if (!so) return check_done ("check_curves");
+
+  for (int i = 0; i < TRIALS; i++)
+    {
+    check_random_screen (so, expected);
+    int cx = check_random (SIZE + 32) - 16;
+    int cy = check_random (SIZE + 32) - 16;
+    int rx = check_random (70), ry = check_random (70);
+    int r1 = check_random (rx + 2);
+    int start = check_random (720) - 360;
+    int end = start + check_random (400);
+    int kind = check_random (KINDS);
+    BOOL fill = check_random (2);
+    uint8_t colour = check_random (16);
+    if (kind != ELLIPSE) ry = rx;
+
+    if (kind == CIRCLE)
+      spi_oled_draw_circle (so, cx, cy, rx, colour, fill);
+    else if (kind == ELLIPSE)
+      spi_oled_draw_ellipse (so, cx, cy, rx, ry, colour, fill);
+    else if (kind == ARC)
+      spi_oled_draw_arc (so, cx, cy, rx, start, end, colour, fill);
+    else
+      spi_oled_fill_ring (so, cx, cy, r1, rx, start, end, colour);
+    spi_oled_pop_clip (so);
+
+    for (int y = -ry; y <= ry; y++)
+      for (int x = -rx; x <= rx; x++)
+        {
+        if (!ref_in_ellipse (x, y, rx, ry)) continue;
+        int ay = y < 0 ? -y : y, ax = x < 0 ? -x : x;
+        BOOL on = TRUE;
+        if (kind == RING)
+          on = r1 == 0 || !ref_in_ellipse (x, y, r1 - 1, r1 - 1);
+        else if (!fill)
+          {
+          int w = ref_half_width (ay, rx, ry);
+          int next = ay < ry ? ref_half_width (ay + 1, rx, ry) : -1;
+          if (next >= w) next = w - 1;
+          on = ax > next;
+          }
+        if (on && kind >= ARC && !ref_in_sector (x, y, start, end))
+          on = FALSE;
+        if (on)
+          check_pixel (so, expected, cx + x, cy + y, colour);
+        }
+
+    CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+      "%s at %d,%d, radii %d,%d, r1 %d, %d to %d degrees, %s, differs",
+      kinds[kind], cx, cy, rx, ry, r1, start, end,
+      fill ? "filled" : "outline");
+    }
+
+  fake_panel_free (so);
+  return check_done ("check_curves");
+  }
+
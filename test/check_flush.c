@@ -0,0 +1,74 @@
+/*========================================================================
+  spi-oled
+  check_flush.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks that a flush that fails to send leaves the damage in place, so
+  that the next flush sends it again -- and that, in diff mode, the 
+  shadow copy of the panel is not updated with what wasn't sent
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+#include "fake_panel.h"
+#include "check.h"
+
+
+static long flush_bytes (SPIOled *so)
+  {
+  long before = fake_spi_bytes;
+  spi_oled_flush (so);
+  return fake_spi_bytes - before;
+  }
+
+
+static BOOL damaged (SPIOled *so)
+  {
+  return so->screen.dirty_x1 < so->screen.dirty_x2 
+    && so->screen.dirty_y1 < so->screen.dirty_y2;
+  }
+
+
+static void check_retry (SPIOled *so, const char *mode)
+  {
+  spi_oled_draw_rect (so, 10, 20, 50, 40, COLOUR_WHITE, TRUE);
+  fake_spi_fail = TRUE;
+  spi_oled_flush (so);
+  fake_spi_fail = FALSE;
+  CHECK (damaged (so), "%s: damage was lost when the flush failed", mode);
+  CHECK (flush_bytes (so) >= 20 * 20, "%s: the failed area wasn't resent",
+    mode);
+  CHECK (!damaged (so), "%s: damage left after a good flush", mode);
+  CHECK (flush_bytes (so) == 0, "%s: a second flush sent something", mode);
+  spi_oled_clear (so, COLOUR_BLACK);
+  spi_oled_flush (so);
+  }
+
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (128, 128);
+  CHECK (so != NULL, "Can't make the fake panel");
+  if (!so) return check_done ("check_flush");
+
+  check_retry (so, "damage");
+  spi_oled_set_flush_mode (so, SPI_OLED_FLUSH_DIFF);
+  check_retry (so, "diff");
+  CHECK (memcmp (so->shadow, so->buffer, 64 * 128) == 0, 
+    "diff: the shadow doesn't match the panel");
+
+  // Entering diff mode flushes; if that fails, the shadow must not claim
+  //  that the panel is up to date
+  spi_oled_set_flush_mode (so, SPI_OLED_FLUSH_DAMAGE);
+  spi_oled_draw_rect (so, 0, 0, 8, 8, COLOUR_WHITE, TRUE);
+  fake_spi_fail = TRUE;
+  spi_oled_set_flush_mode (so, SPI_OLED_FLUSH_DIFF);
+  fake_spi_fail = FALSE;
+  CHECK (flush_bytes (so) >= 8 * 4, 
+    "diff: a failed flush on entering diff mode wasn't resent");
+
+  fake_panel_free (so);
+  return check_done ("check_flush");
+  }
+
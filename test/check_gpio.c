@@ -0,0 +1,115 @@
+/*========================================================================
+  spi-oled
+  check_gpio.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks that the sysfs GPIO backend opens each value file once, in
+  gpio_open(), and afterwards only writes to it. This runs against a
+  fake sysfs tree in a temporary directory. Once the lines are open,
+  each value file is moved aside and replaced with a directory, so
+  that any attempt to open it again fails, while the descriptors that
+  gpio_open() holds still refer to the original files
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <spi_oled/gpio.h>
+#include "check.h"
+
+#define N_PINS 3
+
+static const int pins[N_PINS] = { 8, 24, 25 };
+
+
+static void make_file (const char *dir, const char *name)
+  {
+  char path[512];
+  snprintf (path, sizeof (path), "%s/%s", dir, name);
+  int fd = open (path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  close (fd);
+  }
+
+
+/* The level last written to a value file */
+static char read_value (int fd)
+  {
+  char c = '?';
+  if (pread (fd, &c, 1, 0) != 1) return '?';
+  return c;
+  }
+
+
+int main (int argc, char **argv)
+  {
+  char root[] = "/tmp/spi_oled_gpio_XXXXXX";
+  if (!mkdtemp (root))
+    {
+    perror ("mkdtemp");
+    return 1;
+    }
+  make_file (root, "export");
+  for (int i = 0; i < N_PINS; i++)
+    {
+    char dir[512];
+    snprintf (dir, sizeof (dir), "%s/gpio%d", root, pins[i]);
+    mkdir (dir, 0755);
+    make_file (dir, "direction");
+    make_file (dir, "value");
+    }
+  gpio_sysfs_root = root;
+
+  GPIO *gpio = gpio_open (pins, N_PINS);
+  CHECK (gpio != NULL, "gpio_open() failed");
+  if (!gpio) return check_done ("check_gpio");
+
+  // Swap each value file for a directory, keeping hold of the file
+  int held[N_PINS];
+  for (int i = 0; i < N_PINS; i++)
+    {
+    char path[512], aside[512];
+    snprintf (path, sizeof (path), "%s/gpio%d/value", root, pins[i]);
+    snprintf (aside, sizeof (aside), "%s/gpio%d/value.old", root, pins[i]);
+    held[i] = open (path, O_RDWR);
+    rename (path, aside);
+    mkdir (path, 0755);
+    }
+
+  for (int n = 0; n < 100; n++)
+    {
+    int line = n % N_PINS;
+    GPIOLevel level = (n / N_PINS) & 1 ? GPIO_HIGH : GPIO_LOW;
+    CHECK (gpio_set (gpio, line, level), "gpio_set() failed after open");
+    CHECK (read_value (held[line]) == (level == GPIO_HIGH ? '1' : '0'),
+      "line %d has the wrong value", line);
+    }
+
+  // Setting a line to the level it already has writes nothing
+  pwrite (held[0], "x", 1, 0);
+  GPIOLevel last = ((99 / N_PINS) & 1) ? GPIO_HIGH : GPIO_LOW;
+  gpio_set (gpio, 0, last);
+  CHECK (read_value (held[0]) == 'x', "redundant gpio_set() wrote");
+
+  gpio_close (gpio);
+  for (int i = 0; i < N_PINS; i++)
+    {
+    char path[512];
+    close (held[i]);
+    snprintf (path, sizeof (path), "%s/gpio%d/value", root, pins[i]);
+    rmdir (path);
+    strcat (path, ".old");
+    unlink (path);
+    snprintf (path, sizeof (path), "%s/gpio%d/direction", root, pins[i]);
+    unlink (path);
+    snprintf (path, sizeof (path), "%s/gpio%d", root, pins[i]);
+    rmdir (path);
+    }
+  char path[512];
+  snprintf (path, sizeof (path), "%s/export", root);
+  unlink (path);
+  rmdir (root);
+  return check_done ("check_gpio");
+  }
+
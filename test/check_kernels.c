@@ -0,0 +1,26 @@
+/*========================================================================
+  spi-oled
+  check_kernels.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks every set of bulk buffer kernels that this build and CPU 
+  support against the plain C reference, for bit-exact results
+========================================================================*/
+#include <stdio.h>
+#include <spi_oled/kernels.h>
+#include "check.h"
+
+int main (int argc, char **argv)
+  {
+  const Kernels *sets[KERNELS_MAX_SETS];
+  int n = kernels_available (sets);
+  for (int i = 0; i < n; i++)
+    {
+    BOOL ok = kernels_verify (sets[i]);
+    printf ("check_kernels: %s %s\n", sets[i]->name, ok ? "ok" : "FAILED");
+    CHECK (ok, "The %s kernels don't match the reference", sets[i]->name);
+    }
+  return check_done ("check_kernels");
+  }
+
@@ -0,0 +1,215 @@
+/*========================================================================
+  spi-oled
+  check_layout.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks text layouts of known strings against lines worked out by
+  hand: word wrap, hard newlines, words longer than the box, the three
+  alignments, and the ellipsis when text doesn't fit -- the single
+  character U+2026 for a font that has it, and three dots for one that
+  doesn't. Also checks the layout cache: laying out the same text again
+  returns the same layout, and a layout that loses its slot to other
+  text is laid out afresh when it is asked for again
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+#include <spi_oled/text_layout.h>
+#include <spi_oled/atlas.h>
+#include "check.h"
+
+// The box is 10 columns of Font12 wide, at BX,BY
+#define BX 10
+#define BY 20
+#define BW (10 * 7)
+
+// A font with nothing but an ellipsis, the same size as Font12. Layout
+//  only looks glyphs up, so the glyph needs no pixels
+static uint16_t ellipsis_pages[0x21];
+static uint16_t ellipsis_index[256];
+static const AtlasGlyph ellipsis_glyph = { 0, 0, 0, 0, 0 };
+static const Atlas ellipsis_atlas = { 0x2027, ellipsis_pages,
+  ellipsis_index, &ellipsis_glyph, NULL, ATLAS_BITS };
+static const sFONT ellipsis_font = { NULL, 7, 12, &ellipsis_atlas };
+
+/* Check line i of layout l, which was made from text s */
+static void check_line (const TextLayout *l, const char *s, int i,
+      const char *text, int chars, int x, BOOL ellipsis)
+  {
+  if (i >= l->n_lines) return;
+  const TextLine *line = &l->lines[i];
+  CHECK (line->length == (int)strlen (text)
+    && strncmp (s + line->start, text, line->length) == 0,
+    "\"%s\", line %d: \"%.*s\", not \"%s\"", s, i, line->length,
+    s + line->start, text);
+  CHECK (line->chars == chars && line->x == x
+    && line->y == BY + i * l->font->Height && line->ellipsis == ellipsis,
+    "\"%s\", line %d: %d chars at %d,%d%s, not %d at %d,%d%s", s, i,
+    line->chars, line->x, line->y, line->ellipsis ? " with ellipsis" : "",
+    chars, x, BY + i * l->font->Height, ellipsis ? " with ellipsis" : "");
+  }
+
+
+/* Check the number of lines of a layout, and its bounds */
+static void check_bounds (const TextLayout *l, const char *s, int n,
+      int x1, int y1, int x2, int y2)
+  {
+  CHECK (l->n_lines == n, "\"%s\": %d lines, not %d", s, l->n_lines, n);
+  CHECK (l->x1 == x1 && l->y1 == y1 && l->x2 == x2 && l->y2 == y2,
+    "\"%s\": bounds %d,%d-%d,%d, not %d,%d-%d,%d", s, l->x1, l->y1,
+    l->x2, l->y2, x1, y1, x2, y2);
+  }
+
+
+static void check_wrap (void)
+  {
+  const char *s = "hello world  foo";
+  const TextLayout *l = text_layout (s, &Font12, BX, BY, BW, 36,
+    TEXT_ALIGN_LEFT);
+  check_bounds (l, s, 2, BX, BY, BX + 10 * 7, BY + 24);
+  check_line (l, s, 0, "hello", 5, BX, FALSE);
+  check_line (l, s, 1, "world  foo", 10, BX, FALSE);
+
+  // A line that is full just before a space keeps its last word
+  s = "abcd fghij klm";
+  l = text_layout (s, &Font12, BX, BY, BW, 36, TEXT_ALIGN_LEFT);
+  check_bounds (l, s, 2, BX, BY, BX + 10 * 7, BY + 24);
+  check_line (l, s, 0, "abcd fghij", 10, BX, FALSE);
+  check_line (l, s, 1, "klm", 3, BX, FALSE);
+
+  s = "ab\n\ncd \nef";
+  l = text_layout (s, &Font12, BX, BY, BW, 48, TEXT_ALIGN_LEFT);
+  check_bounds (l, s, 4, BX, BY, BX + 2 * 7, BY + 48);
+  check_line (l, s, 0, "ab", 2, BX, FALSE);
+  check_line (l, s, 1, "", 0, BX, FALSE);
+  check_line (l, s, 2, "cd", 2, BX, FALSE);
+  check_line (l, s, 3, "ef", 2, BX, FALSE);
+
+  // A word longer than the box is broken where the box ends
+  s = "a abcdefghijklmnop";
+  l = text_layout (s, &Font12, BX, BY, BW, 36, TEXT_ALIGN_LEFT);
+  check_bounds (l, s, 3, BX, BY, BX + 10 * 7, BY + 36);
+  check_line (l, s, 0, "a", 1, BX, FALSE);
+  check_line (l, s, 1, "abcdefghij", 10, BX, FALSE);
+  check_line (l, s, 2, "klmnop", 6, BX, FALSE);
+
+  s = "";
+  l = text_layout (s, &Font12, BX, BY, BW, 36, TEXT_ALIGN_LEFT);
+  check_bounds (l, s, 0, BX, BY, BX, BY);
+  }
+
+
+static void check_ellipsis (void)
+  {
+  // Three dots need three columns, so the cut falls after the space,
+  //  which is then trimmed
+  const char *s = "abcd e fghijk";
+  const TextLayout *l = text_layout (s, &Font12, BX, BY, 8 * 7, 12,
+    TEXT_ALIGN_LEFT);
+  check_bounds (l, s, 1, BX, BY, BX + 7 * 7, BY + 12);
+  check_line (l, s, 0, "abcd", 7, BX, TRUE);
+
+  // U+2026 needs one column, so the line keeps all it can fit
+  l = text_layout (s, &ellipsis_font, BX, BY, 8 * 7, 12, TEXT_ALIGN_LEFT);
+  check_bounds (l, s, 1, BX, BY, BX + 7 * 7, BY + 12);
+  check_line (l, s, 0, "abcd e", 7, BX, TRUE);
+
+  // A full last line is cut to make room
+  s = "aaaa bbbb cccc dddd eeee";
+  l = text_layout (s, &Font12, BX, BY, BW, 24, TEXT_ALIGN_LEFT);
+  check_bounds (l, s, 2, BX, BY, BX + 10 * 7, BY + 24);
+  check_line (l, s, 0, "aaaa bbbb", 9, BX, FALSE);
+  check_line (l, s, 1, "cccc dd", 10, BX, TRUE);
+
+  l = text_layout (s, &ellipsis_font, BX, BY, BW, 24, TEXT_ALIGN_LEFT);
+  check_line (l, s, 1, "cccc dddd", 10, BX, TRUE);
+  }
+
+
+static void check_align (void)
+  {
+  const char *s = "abc\nabcde";
+  const TextLayout *l = text_layout (s, &Font12, BX, BY, BW, 36,
+    TEXT_ALIGN_LEFT);
+  check_bounds (l, s, 2, BX, BY, BX + 35, BY + 24);
+  check_line (l, s, 0, "abc", 3, BX, FALSE);
+  check_line (l, s, 1, "abcde", 5, BX, FALSE);
+
+  l = text_layout (s, &Font12, BX, BY, BW, 36, TEXT_ALIGN_CENTRE);
+  check_bounds (l, s, 2, BX + 17, BY, BX + 52, BY + 24);
+  check_line (l, s, 0, "abc", 3, BX + 24, FALSE);
+  check_line (l, s, 1, "abcde", 5, BX + 17, FALSE);
+
+  l = text_layout (s, &Font12, BX, BY, BW, 36, TEXT_ALIGN_RIGHT);
+  check_bounds (l, s, 2, BX + 35, BY, BX + BW, BY + 24);
+  check_line (l, s, 0, "abc", 3, BX + 49, FALSE);
+  check_line (l, s, 1, "abcde", 5, BX + 35, FALSE);
+  }
+
+
+static void check_cache (void)
+  {
+  char s[] = "cached text";
+  const TextLayout *l = text_layout (s, &Font12, BX, BY, BW, 36,
+    TEXT_ALIGN_LEFT);
+  CHECK (l->text != s && strcmp (l->text, s) == 0,
+    "The layout has no copy of its text");
+  // Mark the layout, so that laying it out again would show. The cache
+  //  compares contents, not pointers
+  ((TextLayout *)l)->x1 = -1;
+  char same[] = "cached text";
+  const TextLayout *again = text_layout (same, &Font12, BX, BY, BW, 36,
+    TEXT_ALIGN_LEFT);
+  CHECK (again == l && again->x1 == -1,
+    "Laying out the same text again didn't use the cache");
+  ((TextLayout *)l)->x1 = BX;
+
+  // Find other text that lands in the same slot
+  int i;
+  char other[32];
+  for (i = 0; i < 10000; i++)
+    {
+    snprintf (other, sizeof (other), "other %d", i);
+    if (text_layout (other, &Font12, BX, BY, BW, 36, TEXT_ALIGN_LEFT) == l)
+      break;
+    }
+  CHECK (i < 10000, "No text shares a cache slot with \"%s\"", s);
+  if (i == 10000) return;
+  CHECK (strcmp (l->text, other) == 0, "A collision kept the old text");
+  check_bounds (l, other, 1, BX, BY, BX + strlen (other) * 7, BY + 12);
+  check_line (l, other, 0, other, strlen (other), BX, FALSE);
+
+  again = text_layout (s, &Font12, BX, BY, BW, 36, TEXT_ALIGN_LEFT);
+  CHECK (again == l && strcmp (again->text, s) == 0,
+    "\"%s\" wasn't laid out again after losing its slot", s);
+  check_bounds (again, s, 2, BX, BY, BX + 6 * 7, BY + 24);
+  check_line (again, s, 0, "cached", 6, BX, FALSE);
+  check_line (again, s, 1, "text", 4, BX, FALSE);
+
+  // The same text in a different box is a different layout
+  const TextLayout *moved = text_layout (s, &Font12, BX + 1, BY, BW, 36,
+    TEXT_ALIGN_LEFT);
+  CHECK (moved->box_x == BX + 1 && moved->lines[0].x == BX + 1,
+    "A layout in another box was taken from the cache");
+
+  CHECK (text_layout (NULL, &Font12, BX, BY, BW, 36, TEXT_ALIGN_LEFT)
+    == NULL, "Laying out NULL didn't return NULL");
+  text_layout_cache_clear ();
+  }
+
+
+int main (int argc, char **argv)
+  {
+  for (int i = 0; i < 0x21; i++)
+    ellipsis_pages[i] = i == 0x20 ? 0 : ATLAS_NO_GLYPH;
+  for (int i = 0; i < 256; i++)
+    ellipsis_index[i] = i == 0x26 ? 0 : ATLAS_NO_GLYPH;
+
+  check_wrap ();
+  check_ellipsis ();
+  check_align ();
+  check_cache ();
+  return check_done ("check_layout");
+  }
+
@@ -0,0 +1,84 @@
+/*========================================================================
+  spi-oled
+  check_lines.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks spi_oled_draw_line(), which draws each line as row spans, and
+  horizontal and vertical lines as rectangles, against the original
+  algorithm: Bresenham's, stamping a thickness x thickness square at
+  each step. Lines are random, including ones that are nearly or
+  exactly horizontal or vertical, and ones that run off the screen,
+  and are drawn with random thicknesses and clip rectangles
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+#include "fake_panel.h"
+#include "check.h"
+
+#define SIZE   128
+#define TRIALS 20000
+
+static uint8_t expected[SIZE / 2 * SIZE];
+
+static void ref_line (const SPIOled *so, int x1, int y1, int x2, int y2,
+      int thickness, uint8_t colour)
+  {
+  int x = x1, y = y1;
+  int dx = x2 - x1 >= 0 ? x2 - x1 : x1 - x2;
+  int dy = y2 - y1 <= 0 ? y2 - y1 : y1 - y2;
+  int xadd = x1 < x2 ? 1 : -1;
+  int yadd = y1 < y2 ? 1 : -1;
+  int esp = dx + dy;
+  for (;;)
+    {
+    for (int i = 0; i < thickness; i++)
+      for (int j = 0; j < thickness; j++)
+        check_pixel (so, expected, x + i, y + j, colour);
+    if (2 * esp >= dy)
+      {
+      if (x == x2) break;
+      esp += dy;
+      x += xadd;
+      }
+    if (2 * esp <= dx)
+      {
+      if (y == y2) break;
+      esp += dx;
+      y += yadd;
+      }
+    }
+  }
+
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (SIZE, SIZE);
+  CHECK (so != NULL, "Can't make the fake panel");
+  if (!so) return check_done ("check_lines");
+
+  for (int i = 0; i < TRIALS; i++)
+    {
+    check_random_screen (so, expected);
+    // A third of the lines go well off the screen
+    int range = i % 3 ? SIZE + 12 : 300;
+    int x1 = check_random (range), y1 = check_random (range);
+    int x2 = check_random (range), y2 = check_random (range);
+    if (i % 5 == 0) x2 = x1 + check_random (4);
+    if (i % 7 == 0) y2 = y1 + check_random (3);
+    int thickness = 1 + check_random (9);
+    uint8_t colour = check_random (16);
+    spi_oled_draw_line (so, x1, y1, x2, y2, thickness, colour);
+    ref_line (so, x1, y1, x2, y2, thickness, colour);
+    spi_oled_pop_clip (so);
+    CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+      "%d,%d to %d,%d, thickness %d, clip %d,%d-%d,%d, differs", x1, y1,
+      x2, y2, thickness, check_clip[0], check_clip[1], check_clip[2],
+      check_clip[3]);
+    }
+
+  fake_panel_free (so);
+  return check_done ("check_lines");
+  }
+
@@ -0,0 +1,88 @@
+/*========================================================================
+  spi-oled
+  check_polygon.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks spi_oled_fill_polygon() against its definition: a pixel is
+  filled if its centre is inside the polygon by the even-odd rule. Each
+  pixel of the screen is tested by counting the edges that cross the
+  row through its centre to its left, in exact integer arithmetic. The
+  polygons are random, and so mostly self-intersecting, with some
+  horizontal edges, some far off the screen, and some with more edges
+  than the fill can handle without allocating
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+#include "fake_panel.h"
+#include "check.h"
+
+#define SIZE   128
+#define TRIALS 2000
+#define MAX_POINTS 64
+
+static uint8_t expected[SIZE / 2 * SIZE];
+
+/* Is the centre of pixel x,y inside the polygon? Coordinates are
+ * doubled, so that the centre x + 1/2, y + 1/2 is a whole number. An
+ * edge covers the rows from its top end up to, but not including, its
+ * bottom end, so that a vertex is counted once */
+static BOOL ref_inside (const SPIOledPoint *p, int n, int x, int y)
+  {
+  long long cx = 2 * x + 1, cy = 2 * y + 1;
+  BOOL inside = FALSE;
+  for (int i = 0; i < n; i++)
+    {
+    const SPIOledPoint *a = &p[i], *b = &p[(i + 1) % n];
+    long long ax = 2 * a->x, ay = 2 * a->y, bx = 2 * b->x, by = 2 * b->y;
+    if (ay == by) continue;
+    if (ay > by)
+      {
+      long long t = ay; ay = by; by = t;
+      t = ax; ax = bx; bx = t;
+      }
+    if (cy < ay || cy >= by) continue;
+    // The edge crosses the row at ax + (cy - ay) * (bx - ax) / (by - ay)
+    if (cx * (by - ay) >= ax * (by - ay) + (cy - ay) * (bx - ax))
+      inside = !inside;
+    }
+  return inside;
+  }
+
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (SIZE, SIZE);
+  CHECK (so != NULL, "Can't make the fake panel");
+  if (!so) return check_done ("check_polygon");
+
+  for (int i = 0; i < TRIALS; i++)
+    {
+    check_random_screen (so, expected);
+    SPIOledPoint p[MAX_POINTS];
+    int n = 3 + check_random (i % 10 ? 6 : MAX_POINTS - 3);
+    int range = i % 3 ? SIZE + 12 : 400;
+    for (int j = 0; j < n; j++)
+      {
+      p[j].x = check_random (range) - (range - SIZE) / 2;
+      p[j].y = check_random (range) - (range - SIZE) / 2;
+      if (j > 0 && check_random (4) == 0) p[j].y = p[j - 1].y;
+      }
+    uint8_t colour = check_random (16);
+    spi_oled_fill_polygon (so, p, n, colour);
+    spi_oled_pop_clip (so);
+    for (int y = 0; y < SIZE; y++)
+      for (int x = 0; x < SIZE; x++)
+        if (ref_inside (p, n, x, y))
+          check_pixel (so, expected, x, y, colour);
+    CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+      "trial %d: %d vertices, first %d,%d, clip %d,%d-%d,%d, differs", i,
+      n, p[0].x, p[0].y, check_clip[0], check_clip[1], check_clip[2],
+      check_clip[3]);
+    }
+
+  fake_panel_free (so);
+  return check_done ("check_polygon");
+  }
+
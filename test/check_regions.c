@@ -0,0 +1,153 @@
+/*========================================================================
+  spi-oled
+  check_regions.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks the saved region stack. Random regions -- some with odd edges,
+  some empty, and some partly or wholly off the screen -- are pushed,
+  in nested groups, with random drawing after each push. Each pop must
+  put back exactly the bytes that the region covered when it was
+  pushed, widened to whole bytes, leave the rest of the screen alone,
+  and mark just that rectangle as damaged. Also checks that a push
+  fails, and saves nothing, when the stack or its arena is full
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+#include "fake_panel.h"
+#include "check.h"
+
+#define SIZE   128
+#define TRIALS 2000
+
+static uint8_t saved[SPI_OLED_REGION_DEPTH][SIZE / 2 * SIZE];
+static int regions[SPI_OLED_REGION_DEPTH][4];
+static uint8_t expected[SIZE / 2 * SIZE];
+
+static int random_coord (void)
+  {
+  return check_random (4) ? check_random (SIZE + 20) - 10
+    : check_random (600) - 300;
+  }
+
+
+/* Scribble over the screen */
+static void draw (SPIOled *so)
+  {
+  for (int i = check_random (4); i > 0; i--)
+    spi_oled_fill_rect_rop (so, random_coord (), random_coord (),
+      random_coord (), random_coord (), check_random (16),
+      SPI_OLED_ROP_XOR);
+  }
+
+
+/* Pop region 'depth', and check that it put back what was saved, and
+ * nothing else */
+static void check_pop (SPIOled *so, int trial, int depth)
+  {
+  int *r = regions[depth];
+  // The region as the library should save it: clipped to the screen,
+  //  and then, if it isn't empty, widened to even x values
+  int x1 = r[0] < 0 ? 0 : r[0], y1 = r[1] < 0 ? 0 : r[1];
+  int x2 = r[2] > SIZE ? SIZE : r[2], y2 = r[3] > SIZE ? SIZE : r[3];
+  BOOL empty = x1 >= x2 || y1 >= y2;
+  x1 &= ~1;
+  x2 = (x2 + 1) & ~1;
+
+  memcpy (expected, so->buffer, sizeof (expected));
+  for (int y = y1; y < y2 && !empty; y++)
+    memcpy (expected + y * SIZE / 2 + x1 / 2,
+      saved[depth] + y * SIZE / 2 + x1 / 2, (x2 - x1) / 2);
+  spi_oled_surface_clear_dirty (&so->screen);
+  spi_oled_pop_region (so);
+
+  CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+    "trial %d: pop of %d,%d-%d,%d at depth %d differs", trial, r[0], r[1],
+    r[2], r[3], depth);
+  SPIOledSurface *s = &so->screen;
+  if (empty)
+    CHECK (s->dirty_x1 >= s->dirty_x2 || s->dirty_y1 >= s->dirty_y2,
+      "trial %d: pop of empty %d,%d-%d,%d marked damage %d,%d-%d,%d",
+      trial, r[0], r[1], r[2], r[3], s->dirty_x1, s->dirty_y1,
+      s->dirty_x2, s->dirty_y2);
+  else
+    CHECK (s->dirty_x1 == x1 && s->dirty_y1 == y1 && s->dirty_x2 == x2
+      && s->dirty_y2 == y2, "trial %d: pop of %d,%d-%d,%d marked damage "
+      "%d,%d-%d,%d, not %d,%d-%d,%d", trial, r[0], r[1], r[2], r[3],
+      s->dirty_x1, s->dirty_y1, s->dirty_x2, s->dirty_y2, x1, y1, x2, y2);
+  }
+
+
+static void check_nested (SPIOled *so, int trial)
+  {
+  for (int i = 0; i < SIZE / 2 * SIZE; i++)
+    so->buffer[i] = check_random (256);
+  // Small regions, so that the arena has room for all of them
+  int n = 1 + check_random (SPI_OLED_REGION_DEPTH);
+  for (int depth = 0; depth < n; depth++)
+    {
+    int *r = regions[depth];
+    r[0] = random_coord ();
+    r[1] = random_coord ();
+    r[2] = r[0] + check_random (SIZE / 3) - 2;
+    r[3] = r[1] + check_random (SIZE / 3) - 2;
+    memcpy (saved[depth], so->buffer, sizeof (saved[depth]));
+    CHECK (spi_oled_push_region (so, r[0], r[1], r[2], r[3]),
+      "trial %d: push of %d,%d-%d,%d at depth %d failed", trial, r[0],
+      r[1], r[2], r[3], depth);
+    draw (so);
+    // Sometimes pop and push again, before going deeper
+    if (check_random (3) == 0)
+      {
+      check_pop (so, trial, depth);
+      depth--;
+      }
+    }
+  while (so->region_depth > 0)
+    check_pop (so, trial, so->region_depth - 1);
+  CHECK (so->region_used == 0, "trial %d: %d bytes of the arena are still "
+    "in use", trial, so->region_used);
+  }
+
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (SIZE, SIZE);
+  CHECK (so != NULL, "Can't make the fake panel");
+  if (!so) return check_done ("check_regions");
+
+  for (int i = 0; i < TRIALS; i++)
+    check_nested (so, i);
+
+  // The stack holds SPI_OLED_REGION_DEPTH regions, empty or not
+  for (int i = 0; i < SPI_OLED_REGION_DEPTH; i++)
+    CHECK (spi_oled_push_region (so, i, i, i + i % 2, i + 1),
+      "Push %d of a full stack failed", i);
+  CHECK (!spi_oled_push_region (so, 0, 0, 2, 2),
+    "A push onto a full stack succeeded");
+  CHECK (so->region_depth == SPI_OLED_REGION_DEPTH,
+    "A failed push changed the depth to %d", so->region_depth);
+  while (so->region_depth > 0)
+    spi_oled_pop_region (so);
+
+  // The arena holds one screen
+  CHECK (spi_oled_push_region (so, -5, -5, SIZE + 5, SIZE + 5),
+    "A push of the whole screen failed");
+  int used = so->region_used;
+  CHECK (!spi_oled_push_region (so, 0, 0, 1, 1),
+    "A push into a full arena succeeded");
+  CHECK (so->region_depth == 1 && so->region_used == used,
+    "A failed push changed the stack");
+  // An empty region needs no room, so it still fits
+  CHECK (spi_oled_push_region (so, 300, 300, 310, 310),
+    "A push of an off-screen region into a full arena failed");
+  spi_oled_pop_region (so);
+  spi_oled_pop_region (so);
+  CHECK (so->region_depth == 0 && so->region_used == 0,
+    "The stack isn't empty after the pops");
+
+  fake_panel_free (so);
+  return check_done ("check_regions");
+  }
+
@@ -0,0 +1,178 @@
+/*========================================================================
+  spi-oled
+  check_seg7.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks the cached 7-segment characters against the way the library
+  first drew them: each segment a thick horizontal or vertical line,
+  which is a rectangle from one end to the other plus the thickness.
+  Single digits are drawn at random sizes, positions and clip
+  rectangles; then random strings, including the narrow ':' and '.',
+  characters that aren't drawn, and opaque backgrounds
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+#include "fake_panel.h"
+#include "check.h"
+
+#define SIZE   128
+#define TRIALS 10000
+
+static uint8_t expected[SIZE / 2 * SIZE];
+static const SPIOled *panel;
+
+/*
+ * Segments, as in the original spi_oled_draw_seqment()
+ *      1
+ *    2   3
+ *      4
+ *    5   7
+ *      6
+ */
+static const char *ref_digits[16] =
+  {
+  "123567", "37", "13456", "13467", "2347", "12467", "124567", "137",
+  "1234567", "123467", "123457", "24567", "1256", "34567", "12456", "1245"
+  };
+
+
+static void ref_fill (int x1, int y1, int x2, int y2, uint8_t colour)
+  {
+  for (int y = y1; y < y2; y++)
+    for (int x = x1; x < x2; x++)
+      check_pixel (panel, expected, x, y, colour);
+  }
+
+
+/* A thick line from x1,y1 to x2,y2, which must be horizontal or
+ * vertical */
+static void ref_line (int x1, int y1, int x2, int y2, int t, uint8_t colour)
+  {
+  ref_fill (x1 < x2 ? x1 : x2, y1 < y2 ? y1 : y2,
+    (x1 > x2 ? x1 : x2) + t, (y1 > y2 ? y1 : y2) + t, colour);
+  }
+
+
+static void ref_segment (int x, int y, int height, int t, char seg,
+      uint8_t colour)
+  {
+  int width = height / 2, h2 = height / 2;
+  if (seg == '1') ref_line (x + t, y, x + width - t, y, t, colour);
+  if (seg == '2') ref_line (x, y + t, x, y + h2 - t, t, colour);
+  if (seg == '3') ref_line (x + width, y + t, x + width, y + h2 - t, t,
+    colour);
+  if (seg == '4') ref_line (x + t, y + h2, x + width - t, y + h2, t,
+    colour);
+  if (seg == '5') ref_line (x, y + h2 + t, x, y + height - t, t, colour);
+  if (seg == '6') ref_line (x + t, y + height, x + width - t, y + height,
+    t, colour);
+  if (seg == '7') ref_line (x + width, y + h2 + t, x + width,
+    y + height - t, t, colour);
+  }
+
+
+/* Draw character c, and return its width, or 0 if it isn't drawn */
+static int ref_char (int x, int y, int height, int t, char c, uint8_t fg,
+      uint8_t bg, BOOL opaque)
+  {
+  const char *segs = NULL;
+  if (c >= '0' && c <= '9') segs = ref_digits[c - '0'];
+  else if (c >= 'A' && c <= 'F') segs = ref_digits[c - 'A' + 10];
+  else if (c >= 'a' && c <= 'f') segs = ref_digits[c - 'a' + 10];
+  else if (c == '-') segs = "4";
+  else if (c == ' ') segs = "";
+  int w;
+  if (segs)
+    w = height / 2 + t;
+  else if (c == ':' || c == '.')
+    w = t;
+  else
+    return 0;
+
+  if (opaque) ref_fill (x, y, x + w, y + height + t, bg);
+  int h2 = height / 2;
+  if (segs)
+    {
+    for (; *segs; segs++)
+      ref_segment (x, y, height, t, *segs, fg);
+    }
+  else if (c == ':')
+    {
+    ref_fill (x, y + h2 / 2, x + t, y + h2 / 2 + t, fg);
+    ref_fill (x, y + (h2 + height) / 2, x + t, y + (h2 + height) / 2 + t,
+      fg);
+    }
+  else
+    ref_fill (x, y + height, x + t, y + height + t, fg);
+  return w;
+  }
+
+
+static void ref_string (int x, int y, int height, int t, const char *s,
+      uint8_t fg, uint8_t bg, BOOL opaque)
+  {
+  for (; *s; s++)
+    {
+    int w = ref_char (x, y, height, t, *s, fg, bg, opaque);
+    if (w == 0) continue;
+    x += w;
+    if (opaque && s[1]) ref_fill (x, y, x + t, y + height + t, bg);
+    x += t;
+    }
+  }
+
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (SIZE, SIZE);
+  CHECK (so != NULL, "Can't make the fake panel");
+  if (!so) return check_done ("check_seg7");
+  panel = so;
+
+  for (int i = 0; i < TRIALS; i++)
+    {
+    check_random_screen (so, expected);
+    int height = 4 + check_random (80);
+    int t = 1 + check_random (height / 4);
+    int x = check_random (SIZE + 12), y = check_random (SIZE + 12);
+    int val = check_random (16);
+    uint8_t colour = check_random (16);
+    spi_oled_draw_7seg_digit (so, x, y, height, t, val, colour);
+    ref_char (x, y, height, t, "0123456789ABCDEF"[val], colour, 0, FALSE);
+    spi_oled_pop_clip (so);
+    CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+      "digit %X, height %d, thickness %d, at %d,%d, differs", val,
+      height, t, x, y);
+    }
+
+  const char *chars = "0123456789abcdefABCDEF-:. xyz";
+  for (int i = 0; i < TRIALS; i++)
+    {
+    check_random_screen (so, expected);
+    char s[8];
+    int n = check_random (sizeof (s));
+    for (int j = 0; j < n; j++)
+      s[j] = chars[check_random (strlen (chars))];
+    s[n] = 0;
+    int height = 4 + check_random (40);
+    int t = 1 + check_random (height / 4);
+    int x = check_random (SIZE), y = check_random (SIZE);
+    uint8_t fg = check_random (16), bg = check_random (16);
+    BOOL opaque = check_random (2);
+    if (opaque)
+      spi_oled_draw_7seg_string_opaque (so, x, y, height, t, s, fg, bg);
+    else
+      spi_oled_draw_7seg_string (so, x, y, height, t, s, fg);
+    ref_string (x, y, height, t, s, fg, bg, opaque);
+    spi_oled_pop_clip (so);
+    CHECK (memcmp (so->buffer, expected, sizeof (expected)) == 0,
+      "\"%s\", height %d, thickness %d, at %d,%d, %s, differs", s,
+      height, t, x, y, opaque ? "opaque" : "transparent");
+    }
+
+  fake_panel_free (so);
+  return check_done ("check_seg7");
+  }
+
@@ -0,0 +1,98 @@
+/*========================================================================
+  spi-oled
+  check_text_field.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Checks that a text field redraws only the cells that change. After
+  each text_field_set(), the count of cells redrawn and the damage it
+  marked are compared with the cells that differ, and the field is
+  compared with the same text, padded or truncated to the field's
+  width, drawn afresh with spi_oled_draw_string_opaque(). Also checks
+  that text_field_invalidate() makes the next set redraw every cell
+========================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <spi_oled/spi_oled.h>
+#include <spi_oled/text_field.h>
+#include "fake_panel.h"
+#include "check.h"
+
+#define SIZE  128
+#define X     5
+#define Y     5
+#define CELLS 8
+
+static uint8_t actual[SIZE / 2 * SIZE];
+
+/* Set the field to s, and check that it redraws 'redrawn' cells, from
+ * 'first' to 'last', and then shows 'shown' */
+static void check_set (SPIOled *so, TextField *field, const char *s,
+      int redrawn, int first, int last, const char *shown)
+  {
+  SPIOledSurface *screen = &so->screen;
+  spi_oled_surface_clear_dirty (screen);
+  int n = text_field_set (field, so, s);
+  CHECK (n == redrawn, "\"%s\": redrew %d cells, not %d", s, n, redrawn);
+  if (redrawn == 0)
+    CHECK (screen->dirty_x1 >= screen->dirty_x2,
+      "\"%s\": nothing changed, but damage was marked", s);
+  else
+    {
+    int w = field->font->Width;
+    int x1 = (X + first * w) & ~1, x2 = (X + (last + 1) * w + 1) & ~1;
+    CHECK (screen->dirty_x1 == x1 && screen->dirty_x2 == x2
+      && screen->dirty_y1 == Y && screen->dirty_y2 == Y + field->font->Height,
+      "\"%s\": damage %d,%d-%d,%d, not %d,%d-%d,%d", s, screen->dirty_x1,
+      screen->dirty_y1, screen->dirty_x2, screen->dirty_y2, x1, Y, x2,
+      Y + field->font->Height);
+    }
+
+  // Drawing what the field should show over it must change nothing
+  memcpy (actual, so->buffer, sizeof (actual));
+  spi_oled_draw_string_opaque (so, X, Y, field->font, shown, field->fg,
+    field->bg);
+  CHECK (memcmp (so->buffer, actual, sizeof (actual)) == 0,
+    "\"%s\": the field doesn't show \"%s\"", s, shown);
+  memcpy (so->buffer, actual, sizeof (actual));
+  }
+
+
+int main (int argc, char **argv)
+  {
+  SPIOled *so = fake_panel_new (SIZE, SIZE);
+  CHECK (so != NULL, "Can't make the fake panel");
+  if (!so) return check_done ("check_text_field");
+
+  for (int i = 0; i < (int)sizeof (actual); i++)
+    so->buffer[i] = check_random (256);
+
+  TextField *field = text_field_new (X, Y, &Font20, CELLS, COLOUR_WHITE,
+    COLOUR_BLACK);
+  check_set (so, field, "12:00", 8, 0, 7, "12:00   ");
+  check_set (so, field, "12:01", 1, 4, 4, "12:01   ");
+  check_set (so, field, "12:01", 0, 0, 0, "12:01   ");
+  check_set (so, field, "22:01", 1, 0, 0, "22:01   ");
+  check_set (so, field, "9", 5, 0, 4, "9       ");
+  check_set (so, field, "9      x", 1, 7, 7, "9      x");
+
+  // Only the first CELLS characters are drawn, and nothing beyond them
+  memcpy (actual, so->buffer, sizeof (actual));
+  check_set (so, field, "1234567890AB", 8, 0, 7, "12345678");
+  int end = (X + CELLS * Font20.Width + 1) / 2;
+  for (int y = 0; y < SIZE; y++)
+    CHECK (memcmp (so->buffer + y * SIZE / 2 + end,
+      actual + y * SIZE / 2 + end, SIZE / 2 - end) == 0,
+      "Row %d beyond the field changed", y);
+
+  // Something else drawn over the field is replaced after invalidation
+  spi_oled_clear (so, COLOUR_WHITE);
+  text_field_invalidate (field);
+  check_set (so, field, "1234567890AB", 8, 0, 7, "12345678");
+  check_set (so, field, "12345678", 0, 0, 0, "12345678");
+
+  text_field_free (field);
+  fake_panel_free (so);
+  return check_done ("check_text_field");
+  }
+
@@ -0,0 +1,117 @@
+/*========================================================================
+  spi-oled
+  fake_panel.h
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  A panel that isn't there, for the check and benchmark programs. The
+  library is initialized in the usual way, but the SPI device is
+  /dev/null, and the GPIO lines are files in a fake sysfs tree. The
+  program must be linked with -Wl,--wrap=ioctl: spidev requests then
+  succeed without doing anything, and the bytes in each message are
+  counted, as a measure of what would have been sent
+========================================================================*/
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+#include <spi_oled/spi_oled.h>
+
+// What the panel has been sent since these were last reset
+static long fake_spi_bytes = 0;
+static long fake_spi_messages = 0;
+
+// Set TRUE to make each SPI message fail, as a write to a disconnected
+//  panel would
+static BOOL fake_spi_fail = FALSE;
+
+static char fake_sysfs_root[] = "/tmp/spi_oled_sysfs_XXXXXX";
+static const int fake_pins[] = { OLED_CS, OLED_DC, OLED_RST };
+
+int __real_ioctl (int fd, unsigned long request, ...);
+
+int __wrap_ioctl (int fd, unsigned long request, ...)
+  {
+  va_list ap;
+  va_start (ap, request);
+  void *arg = va_arg (ap, void *);
+  va_end (ap);
+  if (_IOC_TYPE (request) != SPI_IOC_MAGIC)
+    return __real_ioctl (fd, request, arg);
+  if (_IOC_NR (request) != 0)
+    return 0; // A setting, such as the mode or speed
+  if (fake_spi_fail)
+    return -1;
+  const struct spi_ioc_transfer *tr = arg;
+  int n = _IOC_SIZE (request) / sizeof (struct spi_ioc_transfer);
+  int total = 0;
+  for (int i = 0; i < n; i++)
+    total += tr[i].len;
+  fake_spi_bytes += total;
+  fake_spi_messages++;
+  return total;
+  }
+
+
+static void fake_sysfs_path (char *path, int len, int pin, const char *f)
+  {
+  if (pin < 0)
+    snprintf (path, len, "%s/%s", fake_sysfs_root, f);
+  else
+    snprintf (path, len, "%s/gpio%d/%s", fake_sysfs_root, pin, f);
+  }
+
+
+static void fake_sysfs_file (int pin, const char *f)
+  {
+  char path[512];
+  fake_sysfs_path (path, sizeof (path), pin, f);
+  close (open (path, O_WRONLY | O_CREAT | O_TRUNC, 0644));
+  }
+
+
+// Initialize a width x height panel. Returns NULL if the fake sysfs
+//  tree can't be made
+static SPIOled *fake_panel_new (int width, int height)
+  {
+  if (!mkdtemp (fake_sysfs_root)) return NULL;
+  fake_sysfs_file (-1, "export");
+  for (int i = 0; i < 3; i++)
+    {
+    char path[512];
+    fake_sysfs_path (path, sizeof (path), fake_pins[i], "");
+    mkdir (path, 0755);
+    fake_sysfs_file (fake_pins[i], "direction");
+    fake_sysfs_file (fake_pins[i], "value");
+    }
+  gpio_sysfs_root = fake_sysfs_root;
+  return spi_oled_init_with_backend ("/dev/null", width, height,
+    GPIO_BACKEND_SYSFS);
+  }
+
+
+static void fake_panel_free (SPIOled *self)
+  {
+  spi_oled_close (self, FALSE);
+  char path[512];
+  for (int i = 0; i < 3; i++)
+    {
+    fake_sysfs_path (path, sizeof (path), fake_pins[i], "direction");
+    unlink (path);
+    fake_sysfs_path (path, sizeof (path), fake_pins[i], "value");
+    unlink (path);
+    fake_sysfs_path (path, sizeof (path), fake_pins[i], "");
+    rmdir (path);
+    }
+  fake_sysfs_path (path, sizeof (path), -1, "export");
+  unlink (path);
+  rmdir (fake_sysfs_root);
+  }
+
@@ -11,6 +11,7 @@
 #include <unistd.h>
 #include <time.h>
 #include <spi_oled/spi_oled.h>
+#include <spi_oled/text_field.h>
 
 #define DEVICE "/dev/spidev0.0"
 
@@ -46,6 +47,10 @@ int main (int argc, char **argv)
     //spi_oled_draw_7seg_digit (so, 65, 50, 25, 1, 0, COLOUR_WHITE);
     //spi_oled_flush (so);
 
+    // The time is in a text field, which only redraws the digits that
+    //  have changed since the last tick
+    TextField *time_field = text_field_new (5, 5, &Font20, 8, 
+       COLOUR_WHITE, COLOUR_BLACK);
     int ticks = 0;
     for (;;)
       {
@@ -60,9 +65,8 @@ int main (int argc, char **argv)
       else if (ticks == 0)
         {
         // Draw the date
-        spi_oled_draw_rect (so, 29, 25, so->width, 25 + 14, 
-            COLOUR_BLACK, TRUE);
-        spi_oled_draw_string (so, 29, 25, &Font12, tbuff, 3);
+        spi_oled_draw_string_opaque (so, 29, 25, &Font12, tbuff, 3,
+            COLOUR_BLACK);
 
 	// Draw a grey box with a white border
         spi_oled_draw_rect (so, 20, 44, 20 + 85 + 2, 49 + 25 + 2, 
@@ -79,13 +83,13 @@ int main (int argc, char **argv)
 	}
 
       // Draw the time
-      spi_oled_draw_rect (so, 5, 5, so->width, 5 + 16, 0, TRUE);
-      spi_oled_draw_string (so, 5, 5, &Font20, tbuff + 11, COLOUR_WHITE);
+      text_field_set (time_field, so, tbuff + 11);
       spi_oled_flush (so);
       ticks++;
       sleep (1);
       }
 
+    text_field_free (time_field);
     spi_oled_close (so, FALSE);
     }
   else
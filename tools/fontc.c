@@ -0,0 +1,467 @@
+/*========================================================================
+  spi-oled
+  fontc.c
+  Copyright (c)2019-20 Kevin Boone
+  Distributed under the terms of the GPL, v3.0
+
+  Font compiler. Reads a font -- either one of the STM32-style 1bpp
+  tables in fonts/fontN.c, or a BDF file -- and writes C source for a
+  glyph atlas (see atlas.h), and an sFONT that uses it, to stdout. Each
+  glyph is trimmed to the box that contains its pixels, and stored as 
+  1bpp rows. Glyphs are indexed by Unicode code point, through a 
+  two-level table of 256-entry pages, so a BDF font can cover any 
+  characters it likes.
+
+  Usage: fontc [-n name] [-s scale] file.c|file.bdf
+
+  For a .c file, the name defaults to that of the table, without the
+  _Table suffix. For a BDF file, a name must be given.
+
+  With -s, the font is scaled down by the given factor, and each pixel
+  of the result stores how much of its scale x scale block of source 
+  pixels was inked, as one of 16 levels, in a 4bpp coverage atlas. 
+  This makes an anti-aliased font from a larger one. A name must be 
+  given, as for a BDF file
+========================================================================*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+
+// The STM32-style tables cover ' ' to '~'
+#define FIRST_CHAR ' '
+#define LAST_CHAR  '~'
+
+#define MAX_CODE   0x10FFFF
+#define NO_GLYPH   0xFFFF
+
+// Coverage of a fully-inked pixel
+#define FULL       15
+
+// A character cell, one byte per pixel, each 0 to FULL
+typedef struct _Cell
+  {
+  uint32_t code;
+  uint8_t *pixels;
+  int box[4]; // x, y, w, h of the part that has pixels
+  uint32_t offset;
+  } Cell;
+
+// A font as a set of character cells, in no particular order until
+//  they are sorted
+typedef struct _Bitmap
+  {
+  int width;
+  int height;
+  int n;
+  int capacity;
+  Cell *cells;
+  } Bitmap;
+
+
+static void fontc_fail (const char *msg, const char *arg)
+  {
+  fprintf (stderr, "fontc: %s%s\n", msg, arg ? arg : "");
+  exit (1);
+  }
+
+
+static void fontc_add (Bitmap *bm, uint32_t code, uint8_t *pixels)
+  {
+  if (bm->n == bm->capacity)
+    {
+    bm->capacity = bm->capacity ? bm->capacity * 2 : 128;
+    bm->cells = realloc (bm->cells, bm->capacity * sizeof (Cell));
+    }
+  bm->cells[bm->n].code = code;
+  bm->cells[bm->n].pixels = pixels;
+  bm->n++;
+  }
+
+
+static int fontc_compare_cells (const void *a, const void *b)
+  {
+  uint32_t ca = ((const Cell *)a)->code;
+  uint32_t cb = ((const Cell *)b)->code;
+  return ca < cb ? -1 : ca > cb;
+  }
+
+
+static char *fontc_read_file (const char *filename)
+  {
+  FILE *f = fopen (filename, "rb");
+  if (!f) fontc_fail ("Can't open ", filename);
+  fseek (f, 0, SEEK_END);
+  long size = ftell (f);
+  fseek (f, 0, SEEK_SET);
+  char *text = malloc (size + 1);
+  if (fread (text, 1, size, f) != (size_t)size)
+    fontc_fail ("Can't read ", filename);
+  text[size] = 0;
+  fclose (f);
+  return text;
+  }
+
+
+/* Find the number that precedes 'marker' in the text, e.g., the 17 in
+ * "17, / * Width * /" */
+static int fontc_number_before (const char *text, const char *marker)
+  {
+  const char *p = strstr (text, marker);
+  if (!p) fontc_fail ("Can't find ", marker);
+  while (p > text && !isdigit ((unsigned char)p[-1])) p--;
+  while (p > text && isdigit ((unsigned char)p[-1])) p--;
+  return atoi (p);
+  }
+
+
+/* Read an STM32-style font table. The glyphs are stored one after another,
+ * starting at ' ', each row padded to a whole number of bytes, with the
+ * leftmost pixel in the top bit */
+static void fontc_read_c (const char *filename, Bitmap *bm, char *name,
+      int name_size)
+  {
+  char *text = fontc_read_file (filename);
+  bm->width = fontc_number_before (text, "/* Width */");
+  bm->height = fontc_number_before (text, "/* Height */");
+
+  char *p = strstr (text, "_Table");
+  if (!p) fontc_fail ("Can't find font table in ", filename);
+  if (!name[0])
+    {
+    char *start = p;
+    while (start > text && (isalnum ((unsigned char)start[-1])
+        || start[-1] == '_'))
+      start--;
+    snprintf (name, name_size, "%.*s", (int)(p - start), start);
+    }
+
+  p = strchr (p, '{');
+  if (!p) fontc_fail ("Can't find start of table in ", filename);
+  p++;
+
+  // Collect the bytes, skipping comments
+  int capacity = 4096, n = 0;
+  uint8_t *table = malloc (capacity);
+  while (*p && *p != '}')
+    {
+    if (p[0] == '/' && p[1] == '/')
+      {
+      while (*p && *p != '\n') p++;
+      }
+    else if (p[0] == '/' && p[1] == '*')
+      {
+      p = strstr (p, "*/");
+      if (!p) fontc_fail ("Unterminated comment in ", filename);
+      p += 2;
+      }
+    else if (isdigit ((unsigned char)*p))
+      {
+      if (n == capacity)
+        {
+        capacity *= 2;
+        table = realloc (table, capacity);
+        }
+      table[n++] = (uint8_t)strtol (p, &p, 0);
+      }
+    else
+      p++;
+    }
+
+  int bytes_per_row = (bm->width + 7) / 8;
+  int glyph_size = bytes_per_row * bm->height;
+  int glyphs = n / glyph_size;
+  if (glyphs > LAST_CHAR - FIRST_CHAR + 1) 
+    glyphs = LAST_CHAR - FIRST_CHAR + 1;
+  for (int i = 0; i < glyphs; i++)
+    {
+    uint8_t *cell = calloc (bm->width * bm->height, 1);
+    const uint8_t *src = table + i * glyph_size;
+    for (int row = 0; row < bm->height; row++)
+      for (int column = 0; column < bm->width; column++)
+        cell[row * bm->width + column] = (src[row * bytes_per_row
+          + column / 8] & (0x80 >> (column % 8))) ? FULL : 0;
+    fontc_add (bm, FIRST_CHAR + i, cell);
+    }
+
+  free (table);
+  free (text);
+  }
+
+
+/* Read a BDF font. Each glyph's bitmap is placed in a character cell the
+ * size of the font bounding box, using the glyph's own bounding box
+ * offsets relative to the baseline */
+static void fontc_read_bdf (const char *filename, Bitmap *bm)
+  {
+  FILE *f = fopen (filename, "r");
+  if (!f) fontc_fail ("Can't open ", filename);
+  char line[1024];
+  int fx = 0, fy = 0;
+  int encoding = -1, w = 0, h = 0, xo = 0, yo = 0;
+  bm->width = 0;
+  while (fgets (line, sizeof (line), f))
+    {
+    if (strncmp (line, "FONTBOUNDINGBOX ", 16) == 0)
+      sscanf (line + 16, "%d %d %d %d", &bm->width, &bm->height, &fx, &fy);
+    else if (strncmp (line, "ENCODING ", 9) == 0)
+      encoding = atoi (line + 9);
+    else if (strncmp (line, "BBX ", 4) == 0)
+      sscanf (line + 4, "%d %d %d %d", &w, &h, &xo, &yo);
+    else if (strncmp (line, "BITMAP", 6) == 0)
+      {
+      if (bm->width == 0) fontc_fail ("No FONTBOUNDINGBOX in ", filename);
+      int wanted = encoding >= FIRST_CHAR && encoding <= MAX_CODE;
+      uint8_t *cell = wanted ? calloc (bm->width * bm->height, 1) : NULL;
+      int top = (bm->height + fy) - (yo + h);
+      for (int r = 0; r < h && fgets (line, sizeof (line), f); r++)
+        {
+        if (!cell) continue;
+        int len = strspn (line, "0123456789abcdefABCDEF");
+        for (int c = 0; c < w && c / 4 < len; c++)
+          {
+          char hex[2] = { line[c / 4], 0 };
+          int nibble = strtol (hex, NULL, 16);
+          int row = top + r;
+          int column = xo - fx + c;
+          if ((nibble & (8 >> (c % 4))) && row >= 0 && row < bm->height
+               && column >= 0 && column < bm->width)
+            cell[row * bm->width + column] = FULL;
+          }
+        }
+      if (cell)
+        fontc_add (bm, encoding, cell);
+      encoding = -1;
+      }
+    }
+  fclose (f);
+  if (bm->width == 0) fontc_fail ("No glyphs in ", filename);
+  }
+
+
+/* Scale the font down by 'scale', making each pixel of the result the
+ * average of a scale x scale block. A block that runs off the edge of
+ * the cell counts the missing pixels as blank */
+static void fontc_scale (Bitmap *bm, int scale)
+  {
+  int width = (bm->width + scale - 1) / scale;
+  int height = (bm->height + scale - 1) / scale;
+  int area = scale * scale;
+  for (int i = 0; i < bm->n; i++)
+    {
+    uint8_t *src = bm->cells[i].pixels;
+    uint8_t *dst = calloc (width * height, 1);
+    for (int row = 0; row < height; row++)
+      for (int column = 0; column < width; column++)
+        {
+        int sum = 0;
+        for (int r = row * scale; r < (row + 1) * scale; r++)
+          for (int c = column * scale; c < (column + 1) * scale; c++)
+            if (r < bm->height && c < bm->width)
+              sum += src[r * bm->width + c];
+        dst[row * width + column] = (sum + area / 2) / area;
+        }
+    free (src);
+    bm->cells[i].pixels = dst;
+    }
+  bm->width = width;
+  bm->height = height;
+  }
+
+
+/* Write one row of a glyph's box, from 'pixels', as 1bpp or as 4bpp
+ * coverage. Returns the number of bytes written so far */
+static int fontc_write_row (const uint8_t *pixels, int x, int w, 
+      int coverage, int bytes)
+  {
+  int step = coverage ? 2 : 8;
+  for (int column = 0; column < w; column += step)
+    {
+    uint8_t b = 0;
+    for (int i = 0; i < step && column + i < w; i++)
+      {
+      uint8_t p = pixels[x + column + i];
+      if (coverage)
+        b |= p << (4 - 4 * i);
+      else if (p)
+        b |= 0x80 >> i;
+      }
+    printf ("%s0x%02x,", bytes % 12 ? " " : "\n  ", b);
+    bytes++;
+    }
+  return bytes;
+  }
+
+
+static void fontc_write (Bitmap *bm, const char *name,
+      const char *filename, int coverage)
+  {
+  printf ("/*==================================================="
+    "=====================\n");
+  printf ("  spi-oled\n");
+  printf ("  Glyph atlas for %s, generated by tools/fontc from %s\n",
+    name, filename);
+  printf ("  Do not edit -- run 'make atlases' to regenerate\n");
+  printf ("===================================================="
+    "====================*/\n");
+  printf ("#include <stddef.h>\n");
+  printf ("#include <spi_oled/fonts.h>\n");
+  printf ("#include <spi_oled/atlas.h>\n\n");
+
+  // Sort the cells by code point, and drop any duplicates
+  qsort (bm->cells, bm->n, sizeof (Cell), fontc_compare_cells);
+  int n = 0;
+  for (int i = 0; i < bm->n; i++)
+    {
+    if (n > 0 && bm->cells[n - 1].code == bm->cells[i].code)
+      free (bm->cells[i].pixels);
+    else
+      bm->cells[n++] = bm->cells[i];
+    }
+  bm->n = n;
+  if (n == 0) fontc_fail ("No glyphs in ", filename);
+  if (n >= NO_GLYPH) fontc_fail ("Too many glyphs in ", filename);
+
+  // Work out the glyph boxes first, so the index can be written before
+  //  the data
+  uint32_t size = 0;
+  for (int i = 0; i < n; i++)
+    {
+    Cell *cell = &bm->cells[i];
+    int x1 = bm->width, y1 = bm->height, x2 = 0, y2 = 0;
+    for (int row = 0; row < bm->height; row++)
+      for (int column = 0; column < bm->width; column++)
+        if (cell->pixels[row * bm->width + column])
+          {
+          if (column < x1) x1 = column;
+          if (column >= x2) x2 = column + 1;
+          if (row < y1) y1 = row;
+          if (row >= y2) y2 = row + 1;
+          }
+    if (x1 >= x2) x1 = y1 = x2 = y2 = 0;
+    cell->box[0] = x1;
+    cell->box[1] = y1;
+    cell->box[2] = x2 - x1;
+    cell->box[3] = y2 - y1;
+    cell->offset = size;
+    int row_bytes = coverage ? (cell->box[2] + 1) / 2 
+      : (cell->box[2] + 7) / 8;
+    size += row_bytes * cell->box[3];
+    }
+
+  // The page table has an entry for each block of 256 code points up to
+  //  the highest one in the font. Only blocks that have glyphs get a page
+  uint32_t limit = bm->cells[n - 1].code + 1;
+  int top = (limit + 255) / 256;
+  int *pages = malloc (top * sizeof (int));
+  int used = 0;
+  for (int i = 0; i < top; i++) pages[i] = NO_GLYPH;
+  for (int i = 0; i < n; i++)
+    {
+    int page = bm->cells[i].code / 256;
+    if (pages[page] == NO_GLYPH) pages[page] = used++;
+    }
+
+  printf ("static const uint16_t %s_Pages[] = \n  {", name);
+  for (int i = 0; i < top; i++)
+    printf ("%s%d,", i % 12 ? " " : "\n  ", pages[i]);
+  printf ("\n  };\n\n");
+
+  printf ("static const uint16_t %s_Index[] = \n  {", name);
+  int g = 0;
+  for (int i = 0; i < top; i++)
+    {
+    if (pages[i] == NO_GLYPH) continue;
+    // Lookups check the limit first, so the last page need only reach
+    //  the highest code point
+    int end = i == top - 1 ? limit - i * 256 : 256;
+    printf ("\n  // U+%04X", i * 256);
+    for (int j = 0; j < end; j++)
+      {
+      int code = i * 256 + j;
+      int glyph = NO_GLYPH;
+      if (g < n && bm->cells[g].code == (uint32_t)code) glyph = g++;
+      printf ("%s%d,", j % 10 ? " " : "\n  ", glyph);
+      }
+    }
+  printf ("\n  };\n\n");
+
+  printf ("static const AtlasGlyph %s_Glyphs[] = \n  {\n", name);
+  for (int i = 0; i < n; i++)
+    {
+    const Cell *cell = &bm->cells[i];
+    printf ("  { %5u, %2d, %2d, %2d, %2d }, // U+%04X", cell->offset,
+      cell->box[0], cell->box[1], cell->box[2], cell->box[3], cell->code);
+    if (cell->code > ' ' && cell->code < 127 && cell->code != '\\')
+      printf (" '%c'", cell->code);
+    printf ("\n");
+    }
+  printf ("  };\n\n");
+
+  printf ("static const uint8_t %s_Data[] = \n  {", name);
+  int bytes = 0;
+  for (int i = 0; i < n; i++)
+    {
+    const Cell *cell = &bm->cells[i];
+    const int *box = cell->box;
+    for (int row = box[1]; row < box[1] + box[3]; row++)
+      bytes = fontc_write_row (cell->pixels + row * bm->width, box[0],
+        box[2], coverage, bytes);
+    }
+  if (bytes == 0) printf ("\n  0");
+  printf ("\n  };\n\n");
+
+  printf ("const Atlas %s_Atlas = \n  {\n  %u, %s_Pages, %s_Index, "
+    "%s_Glyphs, %s_Data, %s\n  };\n", name, limit, name, name, name, name,
+    coverage ? "ATLAS_COVERAGE" : "ATLAS_BITS");
+  printf ("\nsFONT %s = { NULL, %d, %d, &%s_Atlas };\n", name,
+    bm->width, bm->height, name);
+  free (pages);
+  }
+
+
+int main (int argc, char **argv)
+  {
+  char name[128] = "";
+  const char *filename = NULL;
+  int scale = 1;
+  for (int i = 1; i < argc; i++)
+    {
+    if (strcmp (argv[i], "-n") == 0 && i + 1 < argc)
+      snprintf (name, sizeof (name), "%s", argv[++i]);
+    else if (strcmp (argv[i], "-s") == 0 && i + 1 < argc)
+      scale = atoi (argv[++i]);
+    else
+      filename = argv[i];
+    }
+  if (!filename)
+    {
+    fprintf (stderr, "Usage: fontc [-n name] [-s scale] file.c|file.bdf\n");
+    return 1;
+    }
+  if (scale < 1 || scale > 4) fontc_fail ("The scale must be 1 to 4", NULL);
+  if (scale > 1 && !name[0]) 
+    fontc_fail ("A name (-n) is needed for a scaled font", NULL);
+
+  Bitmap bm;
+  memset (&bm, 0, sizeof (bm));
+  const char *ext = strrchr (filename, '.');
+  int is_bdf = ext && strcmp (ext, ".bdf") == 0;
+  if (is_bdf)
+    {
+    if (!name[0]) fontc_fail ("A name (-n) is needed for a BDF font", NULL);
+    fontc_read_bdf (filename, &bm);
+    }
+  else
+    fontc_read_c (filename, &bm, name, sizeof (name));
+
+  if (scale > 1) fontc_scale (&bm, scale);
+  fontc_write (&bm, name, filename, scale > 1);
+
+  for (int i = 0; i < bm.n; i++)
+    free (bm.cells[i].pixels);
+  free (bm.cells);
+  return 0;
+  }
+